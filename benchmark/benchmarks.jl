@@ -0,0 +1,129 @@
+# Benchmark suite of Kokkos.jl, as a `BenchmarkTools.BenchmarkGroup` named `SUITE`, which can be run
+# through 'run_benchmarks.jl' or with PkgBenchmark.jl.
+
+using BenchmarkTools
+using Kokkos
+
+!Kokkos.is_initialized() && Kokkos.initialize()
+
+
+const SUITE = BenchmarkGroup()
+
+# Bytes moved by each benchmark of a copy, by key path in `SUITE`. Used to compute bandwidths.
+const BYTES_MOVED = Dict{Vector{String}, Int}()
+
+# Memory spaces accessible from the host, in which copies are measured
+const HOST_MEM_SPACES = filter(s -> Kokkos.accessible(Kokkos.DEFAULT_HOST_SPACE, s), Kokkos.ENABLED_MEM_SPACES)
+
+const VECTOR_SIZE = 2^20
+const MATRIX_SIZE = (1024, 1024)
+
+
+host_view(T, dims...; kwargs...) =
+    Kokkos.View{T}(undef, dims...; mem_space=Kokkos.HostSpace, layout=Kokkos.LayoutRight, kwargs...)
+
+function layout_view(T, layout_t, mem_space, dims)
+    layout = layout_t === Kokkos.LayoutStride ? Kokkos.LayoutStride(Base.size_to_strides(1, dims...)) : layout_t
+    return Kokkos.View{T}(undef, dims...; mem_space, layout)
+end
+
+
+#
+# Per-element access from Julia
+#
+
+let g = SUITE["indexing"] = BenchmarkGroup()
+    v1 = host_view(Float64, VECTOR_SIZE)
+    v2 = host_view(Float64, MATRIX_SIZE...)
+    fill!(v1, 1.0); fill!(v2, 1.0)
+    i = VECTOR_SIZE ÷ 2
+    j, k = MATRIX_SIZE .÷ 2
+
+    g[["getindex", "1D"]] = @benchmarkable $v1[$i]
+    g[["getindex", "2D"]] = @benchmarkable $v2[$j, $k]
+    g[["setindex!", "1D"]] = @benchmarkable $v1[$i] = 2.0
+    g[["setindex!", "2D"]] = @benchmarkable $v2[$j, $k] = 2.0
+    # Loops over all elements, divide by the length to get the throughput of a single access
+    g[["sum_loop", "1D"]] = @benchmarkable begin
+        s = 0.0
+        @inbounds for i in eachindex($v1)
+            s += $v1[i]
+        end
+        s
+    end
+end
+
+
+#
+# View allocation, with or without initialization and padding
+#
+
+let g = SUITE["allocation"] = BenchmarkGroup()
+    V1 = Kokkos.View{Float64, 1, Kokkos.LayoutRight, Kokkos.HostSpace}
+    V2 = Kokkos.View{Float64, 2, Kokkos.LayoutRight, Kokkos.HostSpace}
+    for n in (2^10, VECTOR_SIZE)
+        # Views are finalized in the benchmark to not accumulate memory until the next GC
+        g[["1D", string(n), "undef"]] = @benchmarkable Base.finalize($V1(undef, ($n,)))
+        g[["1D", string(n), "zero_fill"]] = @benchmarkable Base.finalize($V1(($n,)))
+    end
+    for dims in ((33, 33), MATRIX_SIZE .+ 1)
+        g[["2D", join(dims, "x"), "undef"]] = @benchmarkable Base.finalize($V2(undef, $dims))
+        g[["2D", join(dims, "x"), "dim_pad"]] = @benchmarkable Base.finalize($V2(undef, $dims; dim_pad=true))
+        g[["2D", join(dims, "x"), "zero_fill+dim_pad"]] = @benchmarkable Base.finalize($V2($dims; dim_pad=true))
+    end
+end
+
+
+#
+# Subview creation
+#
+
+let g = SUITE["subview"] = BenchmarkGroup()
+    v2 = host_view(Float64, MATRIX_SIZE...)
+    v3 = host_view(Float64, 64, 64, 64)
+
+    g[["2D", "column"]] = @benchmarkable Kokkos.subview($v2, (:, 1))
+    g[["2D", "block"]] = @benchmarkable Kokkos.subview($v2, (1:100, 1:100))
+    g[["2D", "strided"]] = @benchmarkable Kokkos.subview($v2, (1:2:1000, :))
+    g[["3D", "plane"]] = @benchmarkable Kokkos.subview($v3, (:, :, 1))
+    g[["3D", "line"]] = @benchmarkable Kokkos.subview($v3, (:, 1, 1))
+end
+
+
+#
+# `deep_copy` bandwidth, for all combinations of layouts and host-accessible memory spaces
+#
+
+let g = SUITE["deep_copy"] = BenchmarkGroup()
+    layouts = (Kokkos.LayoutLeft, Kokkos.LayoutRight, Kokkos.LayoutStride)
+    for src_space in HOST_MEM_SPACES, dst_space in HOST_MEM_SPACES,
+            src_layout in layouts, dst_layout in layouts
+        src = layout_view(Float64, src_layout, src_space, MATRIX_SIZE)
+        dst = layout_view(Float64, dst_layout, dst_space, MATRIX_SIZE)
+        fill!(src, 1.0)
+
+        key = [nameof(src_space), nameof(dst_space), nameof(src_layout), nameof(dst_layout)] .|> string
+        g[key] = @benchmarkable Kokkos.deep_copy($dst, $src)
+        BYTES_MOVED[["deep_copy"; key]] = sizeof(src)
+    end
+end
+
+
+#
+# Mirrors of views in the default memory space of the device and of the host
+#
+
+let g = SUITE["mirrors"] = BenchmarkGroup()
+    for mem_space in unique((Kokkos.DEFAULT_DEVICE_MEM_SPACE, Kokkos.HostSpace))
+        v = Kokkos.View{Float64}(undef, MATRIX_SIZE...; mem_space)
+        space = string(nameof(mem_space))
+        # No allocation if `v` is already accessible from the host
+        g[["create_mirror_view", space]] = @benchmarkable Kokkos.create_mirror_view($v)
+        g[["create_mirror", space]] = @benchmarkable Base.finalize(Kokkos.create_mirror($v))
+        g[["create_mirror+deep_copy", space]] = @benchmarkable begin
+            m = Kokkos.create_mirror_view($v)
+            Kokkos.deep_copy(m, $v)
+        end
+        BYTES_MOVED[["mirrors", "create_mirror+deep_copy", space]] = sizeof(v)
+    end
+end
@@ -0,0 +1,85 @@
+# Worker of 'run_benchmarks.jl': measures the compilation latency of a single sub-library, in its own
+# process, where no library is loaded yet. Also included by 'run_benchmarks.jl' for the list of
+# targets.
+#
+# Usage (from 'run_benchmarks.jl'):
+#   julia --project=benchmark benchmark/compilation_worker.jl <target> <output.json>
+
+using JSON
+using Kokkos
+using Statistics
+
+
+# The parameters given to `compile_and_load` for one library of each sub-library
+function compilation_targets()
+    V1 = Kokkos.View{Float64, 1, Kokkos.LayoutRight, Kokkos.HostSpace}
+    V2 = Kokkos.View{Float64, 2, Kokkos.LayoutRight, Kokkos.HostSpace}
+    view_params(V) = NamedTuple{(:view_type, :view_dim, :view_layout, :mem_space, :mem_traits)}(
+        Kokkos.Views._extract_view_params(V))
+
+    exec_space = Kokkos.DEFAULT_HOST_SPACE
+    mem_traits = Kokkos.memory_traits(V1)
+    kernel_source = Kokkos.Views._kernel_source("benchmark", "x(i) += 1;", [:x], [V1], nothing, :sum)
+
+    targets = [
+        "views"      => view_params(V1),
+        "copy"       => (; view_params(V1)..., dest_layout=Kokkos.LayoutLeft, dest_space=Kokkos.HostSpace,
+                           dest_mem_traits=mem_traits, without_exec_space_arg=true),
+        "mirrors"    => (; view_params(V1)..., dest_space=Kokkos.HostSpace),
+        "subviews"   => (; view_params(V2)..., subview_dim=1),
+        "reductions" => (; view_params(V1)..., exec_space),
+        "algorithms" => (; view_params(V1)..., exec_space),
+        "sort"       => (; view_params(V1)..., exec_space),
+        "broadcast"  => (; view_params(V1)..., exec_space,
+                           broadcast_expr="(BC_VIEW(0) * BC_SCALAR(0))", broadcast_views=1, broadcast_scalars=1),
+        "kernel"     => (; exec_space, mem_space=Kokkos.HostSpace, kernel_source),
+    ]
+
+    missing_targets = setdiff(Kokkos.DynamicCompilation.SUB_LIBRARIES, first.(targets))
+    !isempty(missing_targets) && @warn "No compilation benchmark for: $(join(missing_targets, ", "))"
+    return targets
+end
+
+
+"""
+Cold latency: the library is removed from the cache, then compiled and loaded.
+Warm latency: the library is in the cache, and is only loaded.
+
+The library must not be loaded in this process, nor in any other: it is removed from the cache.
+"""
+function measure_latency(target, params; warm_samples=3)
+    DC = Kokkos.DynamicCompilation
+    lib_name, _ = DC.lib_name_and_parameters(target; params...)
+
+    result = Dict{String, Any}("target" => target, "lib_name" => lib_name)
+    try
+        if haskey(DC.LOADED_FUNCTION_LIBS, lib_name)
+            error("'$lib_name' is already loaded, its cold latency cannot be measured")
+        end
+        rm(joinpath(Kokkos.Wrapper.get_kokkos_func_libs_dir(), lib_name); force=true)
+
+        result["cold_s"] = @elapsed DC.compile_and_load(Kokkos.Views, target; params...)
+        warm = [@elapsed(DC.compile_and_load(Kokkos.Views, target; params...)) for _ in 1:warm_samples]
+        result["warm_s"] = median(warm)
+        result["warm_samples_s"] = warm
+    catch err
+        result["error"] = sprint(showerror, err)
+    end
+    return result
+end
+
+
+function worker_main(args)
+    target = args[1]
+    output = args[2]
+
+    !Kokkos.is_initialized() && Kokkos.initialize()
+
+    targets = Dict(compilation_targets())
+    !haskey(targets, target) && error("unknown compilation target: '$target'")
+    result = measure_latency(target, targets[target])
+    open(io -> JSON.print(io, result), output, "w")
+end
+
+
+abspath(PROGRAM_FILE) == @__FILE__ && worker_main(ARGS)
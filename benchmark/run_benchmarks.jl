@@ -0,0 +1,140 @@
+# Run the benchmark suite of 'benchmarks.jl', measure the compilation latency of each sub-library,
+# then write all results as JSON.
+#
+# Usage:
+#   julia --project=benchmark benchmark/run_benchmarks.jl [options] [output.json]
+#
+# Options:
+#   --seconds=<s>     time budget of each benchmark, in seconds (default: 1)
+#   --group=<name>    only run the benchmarks of the group `name` of `SUITE`, can be repeated
+#   --no-compilation  skip the compilation latency measurements
+#
+# The output defaults to 'benchmark_results.json' in the current directory.
+
+using BenchmarkTools
+using JSON
+using Kokkos
+using Statistics
+
+include("benchmarks.jl")
+include("compilation_worker.jl")
+
+
+function parse_args(args)
+    options = Dict{String, Any}("seconds" => 1.0, "groups" => String[], "compilation" => true,
+                                "output" => "benchmark_results.json")
+    for arg in args
+        if startswith(arg, "--seconds=")
+            options["seconds"] = parse(Float64, last(split(arg, '='; limit=2)))
+        elseif startswith(arg, "--group=")
+            push!(options["groups"], last(split(arg, '='; limit=2)))
+        elseif arg == "--no-compilation"
+            options["compilation"] = false
+        elseif startswith(arg, "--")
+            error("unknown option: $arg")
+        else
+            options["output"] = arg
+        end
+    end
+    return options
+end
+
+
+function metadata()
+    git_commit = try
+        readchomp(Cmd(`git rev-parse HEAD`; dir=@__DIR__))
+    catch
+        nothing
+    end
+
+    return Dict(
+        "date" => Libc.strftime("%Y-%m-%dT%H:%M:%S", time()),
+        "hostname" => gethostname(),
+        "cpu" => first(Sys.cpu_info()).model,
+        "julia_version" => string(VERSION),
+        "julia_threads" => Threads.nthreads(),
+        "omp_num_threads" => get(ENV, "OMP_NUM_THREADS", nothing),
+        "kokkos_jl_version" => string(pkgversion(Kokkos)),
+        "kokkos_jl_commit" => git_commit,
+        "kokkos_version" => string(Kokkos.KOKKOS_VERSION),
+        "kokkos_backends" => Kokkos.KOKKOS_BACKENDS,
+        "kokkos_build_type" => Kokkos.KOKKOS_BUILD_TYPE,
+        "exec_spaces" => string.(nameof.(Kokkos.ENABLED_EXEC_SPACES)),
+        "mem_spaces" => string.(nameof.(Kokkos.ENABLED_MEM_SPACES)),
+    )
+end
+
+
+function trial_result(path, trial)
+    result = Dict{String, Any}(
+        "path" => path,
+        "name" => join(path, "/"),
+        "samples" => length(trial.times),
+        "evals" => trial.params.evals,
+        "min_ns" => minimum(trial).time,
+        "median_ns" => median(trial).time,
+        "mean_ns" => mean(trial).time,
+        "max_ns" => maximum(trial).time,
+        "allocs" => trial.allocs,
+        "memory_bytes" => trial.memory,
+    )
+    bytes = get(BYTES_MOVED, path, nothing)
+    if !isnothing(bytes)
+        result["bytes_moved"] = bytes
+        result["median_bandwidth_GBps"] = bytes / median(trial).time  # bytes/ns == GB/s
+    end
+    return result
+end
+
+
+# Cold measurements need a library which is not loaded yet: each target is measured in a new
+# process, by 'compilation_worker.jl'
+function measure_compilation(target)
+    worker = joinpath(@__DIR__, "compilation_worker.jl")
+    output = tempname()
+    cmd = `$(Base.julia_cmd()) --project=$(Base.active_project()) $worker $target $output`
+    try
+        run(cmd)
+        return JSON.parsefile(output)
+    catch err
+        return Dict{String, Any}("target" => target, "error" => sprint(showerror, err))
+    finally
+        rm(output; force=true)
+    end
+end
+
+
+function main(args)
+    options = parse_args(args)
+
+    suite = SUITE
+    if !isempty(options["groups"])
+        suite = BenchmarkGroup()
+        for group in options["groups"]
+            !haskey(SUITE, group) && error("unknown benchmark group: '$group', expected one of: $(join(keys(SUITE), ", "))")
+            suite[group] = SUITE[group]
+        end
+    end
+
+    @info "Running $(length(BenchmarkTools.leaves(suite))) benchmarks..."
+    results = run(suite; verbose=true, seconds=options["seconds"])
+    benchmarks = [trial_result(string.(path), trial) for (path, trial) in BenchmarkTools.leaves(results)]
+    sort!(benchmarks; by=b -> b["name"])
+
+    compilation = Dict{String, Any}[]
+    if options["compilation"]
+        for (target, _) in compilation_targets()
+            @info "Compilation latency of '$target'..."
+            push!(compilation, measure_compilation(target))
+        end
+    end
+
+    output = Dict("metadata" => metadata(), "benchmarks" => benchmarks, "compilation" => compilation)
+    open(options["output"], "w") do io
+        JSON.print(io, output, 2)
+    end
+    @info "Results written to '$(options["output"])'"
+end
+
+
+abspath(PROGRAM_FILE) == @__FILE__ && main(ARGS)
@@ -0,0 +1,233 @@
+# Strong and weak scaling of the kernels of 'scaling_worker.jl', for all combinations of thread
+# counts, OpenMP places and bindings. Each configuration is run in its own process.
+#
+# Usage:
+#   julia --project=benchmark benchmark/scaling.jl [options] [output.json]
+#
+# Options:
+#   --threads=<n1,n2,...>   thread counts (default: powers of 2 up to `Sys.CPU_THREADS`, and `Sys.CPU_THREADS`)
+#   --places=<p1,p2,...>    values of `OMP_PLACES` (default: cores)
+#   --bind=<b1,b2,...>      values of `OMP_PROC_BIND` (default: close,spread)
+#   --mode=<strong,weak>    scaling modes (default: strong,weak)
+#   --elements=<n>          elements of each kernel, for strong scaling (default: 2^25)
+#   --elements-per-thread=<n>  elements of each kernel per thread, for weak scaling (default: 2^22)
+#   --reps=<n>              repetitions of each kernel (default: 10)
+#
+# The output defaults to 'scaling_results.json' in the current directory. A report of the
+# parallel efficiency of each kernel is also printed.
+
+using JSON
+using Printf
+
+
+function parse_list(f, arg)
+    return map(f, split(last(split(arg, '='; limit=2)), ','; keepempty=false))
+end
+
+
+function parse_args(args)
+    max_threads = Sys.CPU_THREADS
+    options = Dict{String, Any}(
+        "threads" => unique!(sort!([2 .^ (0:floor(Int, log2(max_threads))); max_threads])),
+        "places" => ["cores"],
+        "bind" => ["close", "spread"],
+        "mode" => ["strong", "weak"],
+        "elements" => 2^25,
+        "elements_per_thread" => 2^22,
+        "reps" => 10,
+        "output" => "scaling_results.json"
+    )
+    for arg in args
+        if startswith(arg, "--threads=")
+            options["threads"] = sort!(parse_list(s -> parse(Int, s), arg))
+        elseif startswith(arg, "--places=")
+            options["places"] = parse_list(String, arg)
+        elseif startswith(arg, "--bind=")
+            options["bind"] = parse_list(String, arg)
+        elseif startswith(arg, "--mode=")
+            options["mode"] = parse_list(String, arg)
+            options["mode"] ⊈ ("strong", "weak") && error("unknown scaling mode in: $arg")
+        elseif startswith(arg, "--elements=")
+            options["elements"] = only(parse_list(s -> parse(Int, s), arg))
+        elseif startswith(arg, "--elements-per-thread=")
+            options["elements_per_thread"] = only(parse_list(s -> parse(Int, s), arg))
+        elseif startswith(arg, "--reps=")
+            options["reps"] = only(parse_list(s -> parse(Int, s), arg))
+        elseif startswith(arg, "--")
+            error("unknown option: $arg")
+        else
+            options["output"] = arg
+        end
+    end
+    return options
+end
+
+
+"""
+    parse_cpu_list(str)
+
+Parse a list of CPUs in the format of Linux and OpenMP affinities, e.g. `"0-3,8,10-11"`.
+"""
+function parse_cpu_list(str)
+    cpus = Int[]
+    for range in split(strip(str), ','; keepempty=false)
+        bounds = parse.(Int, split(range, '-'))
+        append!(cpus, first(bounds):last(bounds))
+    end
+    return cpus
+end
+
+
+"""
+    numa_nodes()
+
+`Dict` of the NUMA node of each CPU, from '/sys/devices/system/node', or `nothing` if not available.
+"""
+function numa_nodes()
+    nodes_dir = "/sys/devices/system/node"
+    !isdir(nodes_dir) && return nothing
+    cpu_nodes = Dict{Int, Int}()
+    for node_dir in readdir(nodes_dir)
+        m = match(r"^node(\d+)$", node_dir)
+        isnothing(m) && continue
+        cpu_list = joinpath(nodes_dir, node_dir, "cpulist")
+        !isfile(cpu_list) && continue
+        for cpu in parse_cpu_list(read(cpu_list, String))
+            cpu_nodes[cpu] = parse(Int, m[1])
+        end
+    end
+    return isempty(cpu_nodes) ? nothing : cpu_nodes
+end
+
+
+"""
+    threads_per_numa_node(affinities, cpu_nodes)
+
+Number of threads in each NUMA node. Threads allowed on several nodes are counted in all of them.
+"""
+function threads_per_numa_node(affinities, cpu_nodes)
+    (isnothing(affinities) || isnothing(cpu_nodes)) && return nothing
+    counts = Dict{Int, Int}()
+    for affinity in affinities
+        nodes = unique(get(cpu_nodes, cpu, -1) for cpu in parse_cpu_list(affinity))
+        for node in nodes
+            counts[node] = get(counts, node, 0) + 1
+        end
+    end
+    return counts
+end
+
+
+function run_configuration(num_threads, places, bind, elements, reps)
+    worker = joinpath(@__DIR__, "scaling_worker.jl")
+    output = tempname()
+    cmd = `$(Base.julia_cmd()) --project=$(Base.active_project()) --threads=1 $worker
+           $num_threads $places $bind $elements $reps $output`
+    try
+        run(cmd)
+        return JSON.parsefile(output)
+    finally
+        rm(output; force=true)
+    end
+end
+
+
+"""
+Parallel efficiency of each run, relative to the run with the least threads of the same kernel,
+mode, places and binding.
+Strong scaling: `(t_base * p_base) / (t * p)`. Weak scaling: `t_base / t`.
+Throughputs are in GB/s.
+"""
+function compute_efficiencies!(runs)
+    series = Dict()
+    for run in runs, kernel in run["kernels"]
+        key = (kernel["kernel"], run["mode"], run["places"], run["bind"])
+        push!(get!(series, key, []), (run, kernel))
+    end
+
+    for points in values(series)
+        sort!(points; by=((run, _),) -> run["num_threads"])
+        base_run, base_kernel = first(points)
+        p_base, t_base = base_run["num_threads"], base_kernel["median_s"]
+        for (run, kernel) in points
+            p, t = run["num_threads"], kernel["median_s"]
+            if run["mode"] == "strong"
+                kernel["speedup"] = t_base / t
+                kernel["efficiency"] = (t_base * p_base) / (t * p)
+            else
+                # Scaled speedup: the problem grows with the number of threads
+                kernel["speedup"] = (t_base / t) * (p / p_base)
+                kernel["efficiency"] = t_base / t
+            end
+            kernel["throughput_GBps"] = kernel["bytes"] / t / 1e9
+        end
+    end
+    return runs
+end
+
+
+function print_report(io, runs)
+    kernels = unique(kernel["kernel"] for run in runs for kernel in run["kernels"])
+    for kernel_name in kernels, mode in unique(run["mode"] for run in runs)
+        println(io, "\n", kernel_name, " - ", mode, " scaling")
+        @printf(io, "  %-8s %-8s %8s %12s %10s %8s %6s  %s\n",
+            "places", "bind", "threads", "time (ms)", "GB/s", "speedup", "eff.", "threads per NUMA node")
+        for run in runs
+            run["mode"] != mode && continue
+            kernel = only(filter(k -> k["kernel"] == kernel_name, run["kernels"]))
+            numa = run["threads_per_numa_node"]
+            numa_str = isnothing(numa) ? "-" : join(("$node:$count" for (node, count) in sort(collect(numa))), " ")
+            @printf(io, "  %-8s %-8s %8d %12.3f %10.2f %8.2f %5.0f%%  %s\n",
+                run["places"], run["bind"], run["num_threads"], kernel["median_s"] * 1e3,
+                kernel["throughput_GBps"], kernel["speedup"], kernel["efficiency"] * 100, numa_str)
+        end
+    end
+
+    # Efficiency by number of NUMA nodes spanned by the threads
+    any(run -> isnothing(run["threads_per_numa_node"]), runs) && return
+    println(io, "\nMean parallel efficiency by number of NUMA nodes used")
+    for kernel_name in kernels, mode in unique(run["mode"] for run in runs)
+        by_nodes = Dict{Int, Vector{Float64}}()
+        for run in runs
+            run["mode"] != mode && continue
+            kernel = only(filter(k -> k["kernel"] == kernel_name, run["kernels"]))
+            push!(get!(by_nodes, length(run["threads_per_numa_node"]), Float64[]), kernel["efficiency"])
+        end
+        effs = join((@sprintf("%d node(s): %.0f%%", n, 100 * sum(e) / length(e)) for (n, e) in sort(collect(by_nodes))), ", ")
+        @printf(io, "  %-20s %-6s %s\n", kernel_name, mode, effs)
+    end
+end
+
+
+function main(args)
+    options = parse_args(args)
+    cpu_nodes = numa_nodes()
+
+    runs = Dict{String, Any}[]
+    for mode in options["mode"], places in options["places"], bind in options["bind"],
+            num_threads in options["threads"]
+        elements = mode == "strong" ? options["elements"] : options["elements_per_thread"] * num_threads
+        @info "$mode scaling: $num_threads threads, OMP_PLACES=$places, OMP_PROC_BIND=$bind, $elements elements"
+        run_info = run_configuration(num_threads, places, bind, elements, options["reps"])
+        run_info["mode"] = mode
+        run_info["threads_per_numa_node"] = threads_per_numa_node(run_info["affinities"], cpu_nodes)
+        push!(runs, run_info)
+    end
+
+    compute_efficiencies!(runs)
+    print_report(stdout, runs)
+
+    output = Dict(
+        "hostname" => gethostname(),
+        "cpu" => first(Sys.cpu_info()).model,
+        "cpu_threads" => Sys.CPU_THREADS,
+        "numa_nodes" => isnothing(cpu_nodes) ? nothing : length(unique(values(cpu_nodes))),
+        "options" => options,
+        "runs" => runs
+    )
+    open(io -> JSON.print(io, output, 2), options["output"], "w")
+    @info "Results written to '$(options["output"])'"
+end
+
+
+abspath(PROGRAM_FILE) == @__FILE__ && main(ARGS)
@@ -0,0 +1,124 @@
+# Worker of 'scaling.jl': measures the kernels of a single configuration of threads, in its own
+# process since Kokkos can only be initialized once.
+#
+# Usage (from 'scaling.jl'):
+#   julia --project=benchmark benchmark/scaling_worker.jl <num_threads> <places> <bind> <elements> <reps> <output.json>
+
+using JSON
+using Kokkos
+using Statistics
+
+
+const V1 = Kokkos.View{Float64, 1, Kokkos.LayoutRight, Kokkos.HostSpace}
+const V2 = Kokkos.View{Float64, 2, Kokkos.LayoutRight, Kokkos.HostSpace}
+const V2_left = Kokkos.View{Float64, 2, Kokkos.LayoutLeft, Kokkos.HostSpace}
+
+
+function measure(f, reps)
+    f()  # Warmup, including any compilation
+    return [@elapsed(f()) for _ in 1:reps]
+end
+
+
+# Kernels of the harness: `name => (setup, bytes moved per element)`, `setup(n)` returns the
+# function to measure and the number of elements it processes
+function scaling_kernels()
+    axpy = Kokkos.compile_kernel("scaling_axpy", "y(i) += alpha * x(i);",
+        [:y => V1, :x => V1, :alpha => Float64])
+    dot = Kokkos.compile_kernel("scaling_dot", "result += x(i) * y(i);",
+        [:x => V1, :y => V1]; reduce=Float64)
+    # Same kernel as in 'test/lib/simple_lib/simple_lib_1D.cpp'
+    perfect_gas = Kokkos.compile_kernel("scaling_perfect_gas", """
+        p(i) = (gamma - 1) * rho(i) * (E(i) - 0.5 * (u(i) * u(i) + v(i) * v(i)));
+        c(i) = sqrt(gamma * p(i) / rho(i));
+        """,
+        [:gamma => Float64, :rho => V1, :u => V1, :v => V1, :E => V1, :p => V1, :c => V1])
+
+    filled(n, val=1.0) = fill!(V1(undef, n), val)
+
+    return [
+        "deep_copy" => (n -> begin
+            src, dst = filled(n), V1(undef, n)
+            (() -> Kokkos.deep_copy(dst, src)), n
+        end, 2 * sizeof(Float64)),
+        "deep_copy_transpose" => (n -> begin
+            # Change of layout: the copy is done by a Kokkos kernel
+            side = isqrt(n)
+            src, dst = fill!(V2(undef, side, side), 1.0), V2_left(undef, side, side)
+            (() -> Kokkos.deep_copy(dst, src)), side^2
+        end, 2 * sizeof(Float64)),
+        "axpy" => (n -> begin
+            x, y = filled(n), filled(n)
+            (() -> axpy(n, y, x, 0.5)), n
+        end, 3 * sizeof(Float64)),
+        "dot" => (n -> begin
+            x, y = filled(n), filled(n)
+            (() -> dot(n, x, y)), n
+        end, 2 * sizeof(Float64)),
+        "perfect_gas" => (n -> begin
+            rho, u, v, E, p, c = filled(n), filled(n, 0.1), filled(n, 0.2), filled(n, 2.5), filled(n), filled(n)
+            (() -> perfect_gas(n, 7/5, rho, u, v, E, p, c)), n
+        end, 6 * sizeof(Float64)),
+    ]
+end
+
+
+function thread_affinities()
+    !(Kokkos.OpenMP in Kokkos.ENABLED_EXEC_SPACES) && return nothing
+    # One line per thread: 'thread_num=<i>, thread_affinity=<CPU list>'
+    affinities = Kokkos.BackendFunctions.omp_capture_affinity("%A")
+    return [last(split(line, "thread_affinity="; limit=2)) for line in split(affinities, '\n'; keepempty=false)]
+end
+
+
+function omp_config()
+    !(Kokkos.OpenMP in Kokkos.ENABLED_EXEC_SPACES) && return nothing
+    BF = Kokkos.BackendFunctions
+    return Dict(
+        "max_threads" => BF.omp_get_max_threads(),
+        "proc_bind" => BF.omp_get_proc_bind(),
+        "num_places" => BF.omp_get_num_places(),
+    )
+end
+
+
+function main(args)
+    num_threads = parse(Int, args[1])
+    places, bind = args[2], args[3]
+    n = parse(Int, args[4])
+    reps = parse(Int, args[5])
+    output = args[6]
+
+    # OpenMP reads its environment variables when initialized by Kokkos
+    Kokkos.set_omp_vars(; places, bind, num_threads)
+    Kokkos.initialize(; num_threads, disable_warnings=true)
+
+    results = Dict{String, Any}[]
+    for (name, (setup, bytes_per_element)) in scaling_kernels()
+        f, elements = setup(n)
+        times = measure(f, reps)
+        push!(results, Dict(
+            "kernel" => name,
+            "elements" => elements,
+            "bytes" => bytes_per_element * elements,
+            "times_s" => times,
+            "median_s" => median(times),
+        ))
+        GC.gc()  # Free the views of this kernel before the next one
+    end
+
+    run_info = Dict(
+        "num_threads" => num_threads,
+        "places" => places,
+        "bind" => bind,
+        "exec_space" => string(nameof(Kokkos.DEFAULT_HOST_SPACE)),
+        "concurrency" => Kokkos.concurrency(Kokkos.DEFAULT_HOST_SPACE()),
+        "omp" => omp_config(),
+        "affinities" => thread_affinities(),
+        "kernels" => results,
+    )
+    open(io -> JSON.print(io, run_info), output, "w")
+end
+
+
+main(ARGS)
@@ -8,11 +8,16 @@ p_VIEW_DIM=$(echo "$VIEW_DIM" | tr -d '"')
 p_VIEW_TYPE=$(echo "$VIEW_TYPE" | tr -d '"')
 p_EXEC_SPACE=$(echo "$EXEC_SPACE" | tr -d '"')
 p_MEM_SPACE=$(echo "$MEM_SPACE" | tr -d '"')
+p_VIEW_MEM_TRAITS=$(echo "$VIEW_MEM_TRAITS" | tr -d '"')
 p_DEST_LAYOUT=$(echo "$DEST_LAYOUT" | tr -d '"')
+p_DEST_MEM_TRAITS=$(echo "$DEST_MEM_TRAITS" | tr -d '"')
 p_DEST_MEM_SPACE=$(echo "$DEST_MEM_SPACE" | tr -d '"')
 p_WITHOUT_EXEC_SPACE_ARG=$(echo "$WITHOUT_EXEC_SPACE_ARG" | tr -d '"')
 p_WITH_NOTHING_ARG=$(echo "$WITH_NOTHING_ARG" | tr -d '"')
 p_SUBVIEW_DIM=$(echo "$SUBVIEW_DIM" | tr -d '"')
+p_BROADCAST_EXPR=$(echo "$BROADCAST_EXPR" | tr -d '"')
+p_BROADCAST_VIEWS=$(echo "$BROADCAST_VIEWS" | tr -d '"')
+p_BROADCAST_SCALARS=$(echo "$BROADCAST_SCALARS" | tr -d '"')
 
 
 # build_parameters.h ends up in the current build directory
@@ -27,9 +32,11 @@ cat > ./build_parameters.h <<- END_OF_FILE
 #define VIEW_TYPE $p_VIEW_TYPE
 #define EXEC_SPACE $p_EXEC_SPACE
 #define MEM_SPACE $p_MEM_SPACE
+#define VIEW_MEM_TRAITS $p_VIEW_MEM_TRAITS
 
 // copy.cpp parameters
 #define DEST_LAYOUT $p_DEST_LAYOUT
+#define DEST_MEM_TRAITS $p_DEST_MEM_TRAITS
 #define WITHOUT_EXEC_SPACE_ARG $p_WITHOUT_EXEC_SPACE_ARG
 
 // mirrors.cpp parameters
@@ -39,6 +46,11 @@ cat > ./build_parameters.h <<- END_OF_FILE
 // subviews.cpp parameters
 #define SUBVIEW_DIM $p_SUBVIEW_DIM
 
+// broadcast.cpp parameters
+#define BROADCAST_EXPR $p_BROADCAST_EXPR
+#define BROADCAST_VIEWS $p_BROADCAST_VIEWS
+#define BROADCAST_SCALARS $p_BROADCAST_SCALARS
+
 #endif // KOKKOS_WRAPPER_BUILD_PARAMETERS_H
 
 END_OF_FILE
@@ -3,6 +3,7 @@
 
 #include "spaces.h"
 #include "layouts.h"
+#include "profiling.h"
 
 #include <sstream>
 
@@ -129,12 +130,30 @@ void print_configuration(jl_value_t* io, bool verbose)
 }
 
 
+void define_profiling_regions(jlcxx::Module& mod)
+{
+    mod.method("profile_library_loaded", [](){ return Kokkos::Profiling::profileLibraryLoaded(); });
+
+    mod.method("push_region", [](const std::string& name){ Kokkos::Profiling::pushRegion(name); });
+    mod.method("pop_region", [](){ Kokkos::Profiling::popRegion(); });
+    mod.method("mark_event", [](const std::string& name){ Kokkos::Profiling::markEvent(name); });
+
+    mod.method("create_profile_section", [](const std::string& name) {
+        uint32_t section_id;
+        Kokkos::Profiling::createProfileSection(name, &section_id);
+        return section_id;
+    });
+    mod.method("start_section", [](uint32_t section_id){ Kokkos::Profiling::startSection(section_id); });
+    mod.method("stop_section", [](uint32_t section_id){ Kokkos::Profiling::stopSection(section_id); });
+    mod.method("destroy_profile_section", [](uint32_t section_id){ Kokkos::Profiling::destroyProfileSection(section_id); });
+}
+
+
 void import_all_env_methods(jl_module_t* impl_module, jl_module_t* kokkos_module)
 {
     // In order to override the methods in the main Kokkos module, we must have them imported
     const std::array declared_methods = {
             "print_configuration",
-            "initialize",
             "finalize",
             "fence",
             "num_threads",
@@ -152,7 +171,15 @@ void import_all_env_methods(jl_module_t* impl_module, jl_module_t* kokkos_module
             "tune_internals!",
             "tools_libs!",
             "tools_args!",
-            "map_device_id_by!"
+            "map_device_id_by!",
+            "profile_library_loaded",
+            "push_region",
+            "pop_region",
+            "mark_event",
+            "create_profile_section",
+            "start_section",
+            "stop_section",
+            "destroy_profile_section"
     };
 
     for (auto& method : declared_methods) {
@@ -204,7 +231,6 @@ JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
     define_initialization_settings(mod);
     mod.method("print_configuration", &print_configuration);
 
-    mod.method("initialize", &kokkos_init);
     mod.method("finalize", &kokkos_finalize);
 
     mod.method("is_initialized",  (bool (*)()) &Kokkos::is_initialized);
@@ -217,12 +243,16 @@ JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
     mod.method("fence", &Kokkos::fence);
 #endif // __INTEL_COMPILER
 
+    define_profiling_regions(mod);
+
     mod.unset_override_module();
 
     mod.method("__kokkos_version", &kokkos_version);
+    mod.method("__initialize", &kokkos_init);  // Called by `Kokkos.initialize(settings)`
 
     register_view_finalizer(kokkos_module);
 
     define_all_layouts(mod);
     define_all_spaces(mod);
+    define_profiling(mod);
 }
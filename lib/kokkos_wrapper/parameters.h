@@ -17,20 +17,28 @@
 #define VIEW_TYPE
 #define EXEC_SPACE
 #define MEM_SPACE
+#define VIEW_MEM_TRAITS
 #define DEST_LAYOUT NONE
+#define DEST_MEM_TRAITS
 #define WITHOUT_EXEC_SPACE_ARG
 #define DEST_MEM_SPACE
 #define WITH_NOTHING_ARG
 #define SUBVIEW_DIM
+#define BROADCAST_EXPR
+#define BROADCAST_VIEWS
+#define BROADCAST_SCALARS
 
 #else
-#include "build_parameters.h"  // Header generated at build time by 'build_parameters.sh'
+#if __has_include("build_parameters.h")
+#include "build_parameters.h"  // Header generated at build time by 'build_parameters.sh', one for each instance
+#endif
 
 // Default values to work with an IDE:
-//  - view: Kokkos::View<double**, Kokkos::LayoutLeft, Kokkos::DefaultMemorySpace>
+//  - view: Kokkos::View<double**, Kokkos::LayoutLeft, Kokkos::DefaultMemorySpace, Kokkos::MemoryTraits<0>>
 //  - deep_copy destination: on HostSpace
 //  - mirror memory space: HostSpace
 //  - subview dimension: 1
+//  - broadcast expression: `dest .= view .* scalar`
 
 #ifndef VIEW_LAYOUT
 #define VIEW_LAYOUT left
@@ -52,10 +60,18 @@
 #define MEM_SPACE "HostSpace"
 #endif
 
+#ifndef VIEW_MEM_TRAITS
+#define VIEW_MEM_TRAITS 0
+#endif
+
 #ifndef DEST_LAYOUT
 #define DEST_LAYOUT VIEW_LAYOUT
 #endif
 
+#ifndef DEST_MEM_TRAITS
+#define DEST_MEM_TRAITS VIEW_MEM_TRAITS
+#endif
+
 #ifndef WITHOUT_EXEC_SPACE_ARG
 #define WITHOUT_EXEC_SPACE_ARG 0
 #endif
@@ -72,6 +88,18 @@
 #define SUBVIEW_DIM 1
 #endif
 
+#ifndef BROADCAST_EXPR
+#define BROADCAST_EXPR (BC_VIEW(0) * BC_SCALAR(0))
+#endif
+
+#ifndef BROADCAST_VIEWS
+#define BROADCAST_VIEWS 1
+#endif
+
+#ifndef BROADCAST_SCALARS
+#define BROADCAST_SCALARS 1
+#endif
+
 #endif //WRAPPER_BUILD
 
 
@@ -83,11 +111,16 @@ inline const char* get_params_string()
         "\nVIEW_TYPE         = " AS_STR(VIEW_TYPE)
         "\nEXEC_SPACE        = " AS_STR(EXEC_SPACE)
         "\nMEM_SPACE         = " AS_STR(MEM_SPACE)
+        "\nVIEW_MEM_TRAITS   = " AS_STR(VIEW_MEM_TRAITS)
         "\nDEST_LAYOUT       = " AS_STR(DEST_LAYOUT)
+        "\nDEST_MEM_TRAITS   = " AS_STR(DEST_MEM_TRAITS)
         "\nWITHOUT_EXEC_SPACE_ARG = " AS_STR(WITHOUT_EXEC_SPACE_ARG)
         "\nDEST_MEM_SPACE    = " AS_STR(DEST_MEM_SPACE)
         "\nWITH_NOTHING_ARG  = " AS_STR(WITH_NOTHING_ARG)
-        "\nSUBVIEW_DIM       = " AS_STR(SUBVIEW_DIM);
+        "\nSUBVIEW_DIM       = " AS_STR(SUBVIEW_DIM)
+        "\nBROADCAST_EXPR    = " AS_STR(BROADCAST_EXPR)
+        "\nBROADCAST_VIEWS   = " AS_STR(BROADCAST_VIEWS)
+        "\nBROADCAST_SCALARS = " AS_STR(BROADCAST_SCALARS);
     return params_str;
 }
 
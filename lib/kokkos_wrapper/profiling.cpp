@@ -0,0 +1,622 @@
+
+#include "profiling.h"
+#include "kokkos_wrapper.h"
+#include "memory_spaces.h"
+
+#include "jlcxx/stl.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using EventSet = Kokkos::Tools::Experimental::EventSet;
+
+
+/**
+ * Kinds of events measured by the kernel profiler. Must be in the same order as `Kokkos._PROFILE_EVENT_KINDS`.
+ */
+enum EventKind : int {
+    ParallelFor, ParallelReduce, ParallelScan, DeepCopy, Fence,
+    EventKindCount
+};
+
+
+struct KernelStats {
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t min_ns = std::numeric_limits<uint64_t>::max();
+    uint64_t max_ns = 0;
+
+    void merge(const KernelStats& other)
+    {
+        count += other.count;
+        total_ns += other.total_ns;
+        min_ns = std::min(min_ns, other.min_ns);
+        max_ns = std::max(max_ns, other.max_ns);
+    }
+};
+
+
+using KernelStatsTable = std::array<std::unordered_map<std::string, KernelStats>, EventKindCount>;
+
+
+/**
+ * Stats of the events of a kind and label in a single thread. Only this thread writes to them, while snapshots may read
+ * them at any time: all fields are atomics, updated with plain loads and stores since there is a single writer.
+ * A snapshot may therefore see the count of an event without its duration, which is negligible.
+ */
+struct KernelStatsEntry {
+    const EventKind kind;
+    const std::string label;
+    KernelStatsEntry* const next;  // The entry of the same thread created before this one
+
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> min_ns{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> max_ns{0};
+
+    KernelStatsEntry(EventKind kind, std::string label, KernelStatsEntry* next)
+        : kind(kind), label(std::move(label)), next(next)
+    {}
+
+    void add(uint64_t duration_ns)
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+        count.store(count.load(relaxed) + 1, relaxed);
+        total_ns.store(total_ns.load(relaxed) + duration_ns, relaxed);
+        min_ns.store(std::min(min_ns.load(relaxed), duration_ns), relaxed);
+        max_ns.store(std::max(max_ns.load(relaxed), duration_ns), relaxed);
+    }
+
+    void clear()
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+        count.store(0, relaxed);
+        total_ns.store(0, relaxed);
+        min_ns.store(std::numeric_limits<uint64_t>::max(), relaxed);
+        max_ns.store(0, relaxed);
+    }
+
+    [[nodiscard]] KernelStats load() const
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+        return { count.load(relaxed), total_ns.load(relaxed), min_ns.load(relaxed), max_ns.load(relaxed) };
+    }
+};
+
+
+// Incremented by each reset of the kernel profile. Threads clear their stats on their next event, and snapshots ignore
+// the stats of threads which did not yet.
+std::atomic<uint64_t> stats_epoch{0};
+
+
+struct OpenEvent {
+    EventKind kind;
+    std::string label;
+    Clock::time_point start;
+    uint64_t tool_id;  // ID given by the tool loaded before the profiler
+    bool open = false;
+};
+
+
+// Incremented each time the profiler is enabled. Part of the IDs of events, in their upper 32 bits, to recognize the
+// events opened by the profiler while it was enabled, from the ones opened before (by another tool, or by the profiler
+// before it was disabled).
+std::atomic<uint64_t> profiler_generation{0};
+
+
+/**
+ * Events of a single thread. Kokkos calls the begin and end callbacks of an event from the same thread, therefore
+ * only the stats are shared. They are in a list of `KernelStatsEntry`, in which entries are only added at the front:
+ * snapshots from Julia read them without any lock.
+ */
+struct ThreadBuffer {
+    std::vector<OpenEvent> open_events;  // The ID of an event is its index in this vector, and the generation
+    std::vector<uint64_t> free_slots;
+    std::vector<uint64_t> open_deep_copies;  // Deep copies have no ID, but they cannot overlap in the same thread
+    uint64_t generation = 0;
+
+    std::array<std::unordered_map<std::string, std::unique_ptr<KernelStatsEntry>>, EventKindCount> stats;  // Not shared
+    std::atomic<KernelStatsEntry*> stats_head{nullptr};
+    std::atomic<uint64_t> buffer_stats_epoch{stats_epoch.load()};
+
+    void sync_generation()
+    {
+        const uint64_t current = profiler_generation.load(std::memory_order_relaxed);
+        if (generation == current) return;
+        // Events opened before the profiler was disabled will never be closed
+        open_events.clear();
+        free_slots.clear();
+        open_deep_copies.clear();
+        generation = current;
+    }
+
+    uint64_t event_id(uint64_t slot) const { return (generation << 32) | slot; }
+
+    void add_stats(EventKind kind, const std::string& label, uint64_t duration_ns)
+    {
+        const uint64_t epoch = stats_epoch.load(std::memory_order_acquire);
+        if (buffer_stats_epoch.load(std::memory_order_relaxed) != epoch) {
+            // The profile was reset: entries are cleared before being visible again to snapshots
+            for (KernelStatsEntry* entry = stats_head.load(std::memory_order_relaxed); entry; entry = entry->next) {
+                entry->clear();
+            }
+            buffer_stats_epoch.store(epoch, std::memory_order_release);
+        }
+
+        auto& entry = stats[kind][label];
+        if (!entry) {
+            entry = std::make_unique<KernelStatsEntry>(kind, label, stats_head.load(std::memory_order_relaxed));
+            stats_head.store(entry.get(), std::memory_order_release);
+        }
+        entry->add(duration_ns);
+    }
+
+    uint64_t open(EventKind kind, const char* label)
+    {
+        sync_generation();
+
+        uint64_t slot;
+        if (free_slots.empty()) {
+            slot = open_events.size();
+            open_events.emplace_back();
+        } else {
+            slot = free_slots.back();
+            free_slots.pop_back();
+        }
+
+        OpenEvent& event = open_events[slot];
+        event.kind = kind;
+        event.label = label;
+        event.tool_id = 0;
+        event.open = true;
+        return slot;
+    }
+
+    /**
+     * Close the event with the ID `id` and return the ID given to it by the previous tool, or `id` itself if the event
+     * was not opened by the profiler (it started before the profiler was enabled).
+     */
+    uint64_t close(uint64_t id, Clock::time_point end)
+    {
+        sync_generation();
+
+        const uint64_t slot = id & 0xFFFFFFFF;
+        if ((id >> 32) != generation || slot >= open_events.size() || !open_events[slot].open) return id;
+        OpenEvent& event = open_events[slot];
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - event.start).count();
+
+        add_stats(event.kind, event.label, static_cast<uint64_t>(duration));
+
+        event.open = false;
+        free_slots.push_back(slot);
+        return event.tool_id;
+    }
+};
+
+
+std::mutex buffers_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> thread_buffers;  // Never freed: stats outlive their thread
+
+
+ThreadBuffer& local_buffer()
+{
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (buffer == nullptr) {
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        buffer = thread_buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+    }
+    return *buffer;
+}
+
+
+bool kernel_profiler_enabled = false;
+EventSet previous_events;  // Callbacks replaced by the profiler, called after the ones of the profiler
+
+
+template<EventKind Kind, auto PreviousBegin>
+void begin_event(const char* name, const uint32_t device_id, uint64_t* id)
+{
+    ThreadBuffer& buffer = local_buffer();
+    const uint64_t slot = buffer.open(Kind, name);
+    if (auto previous = previous_events.*PreviousBegin) {
+        previous(name, device_id, &buffer.open_events[slot].tool_id);
+    }
+    *id = buffer.event_id(slot);
+    buffer.open_events[slot].start = Clock::now();  // Exclude the overhead of the previous tool
+}
+
+
+template<auto PreviousEnd>
+void end_event(const uint64_t id)
+{
+    const auto end = Clock::now();
+    const uint64_t tool_id = local_buffer().close(id, end);
+    if (auto previous = previous_events.*PreviousEnd) {
+        previous(tool_id);
+    }
+}
+
+
+void begin_deep_copy(Kokkos::Profiling::SpaceHandle dst_handle, const char* dst_name, const void* dst_ptr,
+                     Kokkos::Profiling::SpaceHandle src_handle, const char* src_name, const void* src_ptr,
+                     uint64_t size)
+{
+    ThreadBuffer& buffer = local_buffer();
+    const std::string label = std::string(dst_name) + " <- " + src_name;
+    buffer.open_deep_copies.push_back(buffer.open(DeepCopy, label.c_str()));
+    if (auto previous = previous_events.begin_deep_copy) {
+        previous(dst_handle, dst_name, dst_ptr, src_handle, src_name, src_ptr, size);
+    }
+    buffer.open_events[buffer.open_deep_copies.back()].start = Clock::now();
+}
+
+
+void end_deep_copy()
+{
+    const auto end = Clock::now();
+    ThreadBuffer& buffer = local_buffer();
+    buffer.sync_generation();
+    if (!buffer.open_deep_copies.empty()) {
+        buffer.close(buffer.event_id(buffer.open_deep_copies.back()), end);
+        buffer.open_deep_copies.pop_back();
+    }
+    if (auto previous = previous_events.end_deep_copy) {
+        previous();
+    }
+}
+
+
+void enable_kernel_profiler()
+{
+    if (!Kokkos::is_initialized() || Kokkos::is_finalized()) {
+        jl_error("Kokkos must be initialized to enable the kernel profiler");
+    }
+    if (kernel_profiler_enabled) return;
+
+    EventSet events = Kokkos::Tools::Experimental::get_callbacks();
+    previous_events = events;
+
+    events.begin_parallel_for = begin_event<ParallelFor, &EventSet::begin_parallel_for>;
+    events.end_parallel_for = end_event<&EventSet::end_parallel_for>;
+    events.begin_parallel_reduce = begin_event<ParallelReduce, &EventSet::begin_parallel_reduce>;
+    events.end_parallel_reduce = end_event<&EventSet::end_parallel_reduce>;
+    events.begin_parallel_scan = begin_event<ParallelScan, &EventSet::begin_parallel_scan>;
+    events.end_parallel_scan = end_event<&EventSet::end_parallel_scan>;
+    events.begin_fence = begin_event<Fence, &EventSet::begin_fence>;
+    events.end_fence = end_event<&EventSet::end_fence>;
+    events.begin_deep_copy = begin_deep_copy;
+    events.end_deep_copy = end_deep_copy;
+
+    profiler_generation++;
+    Kokkos::Tools::Experimental::set_callbacks(events);
+    kernel_profiler_enabled = true;
+}
+
+
+void disable_kernel_profiler()
+{
+    if (!kernel_profiler_enabled) return;
+
+    // Only restore the callbacks of the profiler, others might have been changed since
+    EventSet events = Kokkos::Tools::Experimental::get_callbacks();
+    events.begin_parallel_for = previous_events.begin_parallel_for;
+    events.end_parallel_for = previous_events.end_parallel_for;
+    events.begin_parallel_reduce = previous_events.begin_parallel_reduce;
+    events.end_parallel_reduce = previous_events.end_parallel_reduce;
+    events.begin_parallel_scan = previous_events.begin_parallel_scan;
+    events.end_parallel_scan = previous_events.end_parallel_scan;
+    events.begin_fence = previous_events.begin_fence;
+    events.end_fence = previous_events.end_fence;
+    events.begin_deep_copy = previous_events.begin_deep_copy;
+    events.end_deep_copy = previous_events.end_deep_copy;
+
+    Kokkos::Tools::Experimental::set_callbacks(events);
+    kernel_profiler_enabled = false;
+}
+
+
+/**
+ * The stats of all threads merged by event kind and label, as a tuple of columns: kinds, labels, counts, and the
+ * total, min and max durations in nanoseconds.
+ */
+auto kernel_profile()
+{
+    KernelStatsTable merged;
+    {
+        // Only protects `thread_buffers`: the stats are read while threads may update them
+        std::lock_guard<std::mutex> buffers_lock(buffers_mutex);
+        const uint64_t epoch = stats_epoch.load(std::memory_order_acquire);
+        for (auto& buffer : thread_buffers) {
+            // Stats from before the last reset
+            if (buffer->buffer_stats_epoch.load(std::memory_order_acquire) != epoch) continue;
+            auto* entry = buffer->stats_head.load(std::memory_order_acquire);
+            for (; entry != nullptr; entry = entry->next) {
+                const KernelStats stats = entry->load();
+                if (stats.count == 0) continue;
+                merged[entry->kind][entry->label].merge(stats);
+            }
+        }
+    }
+
+    std::vector<int> kinds;
+    std::vector<std::string> labels;
+    std::vector<uint64_t> counts, totals, mins, maxs;
+    for (int kind = 0; kind < EventKindCount; kind++) {
+        for (const auto& [label, stats] : merged[kind]) {
+            kinds.push_back(kind);
+            labels.push_back(label);
+            counts.push_back(stats.count);
+            totals.push_back(stats.total_ns);
+            mins.push_back(stats.min_ns);
+            maxs.push_back(stats.max_ns);
+        }
+    }
+
+    return std::make_tuple(kinds, labels, counts, totals, mins, maxs);
+}
+
+
+void reset_kernel_profile()
+{
+    // Each thread clears its own stats on its next event
+    stats_epoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
+
+/**
+ * Memory allocated in a memory space. Totals are atomic in order to be read at any time, while the tables of live
+ * allocations are updated under a lock, as allocations are far less frequent than kernels.
+ */
+struct SpaceMemory {
+    std::atomic<int64_t> live_bytes{0};
+    std::atomic<int64_t> high_water_bytes{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> deallocations{0};
+
+    struct LabelMemory {
+        int64_t live_bytes = 0;
+        int64_t live_allocations = 0;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<const void*, std::pair<std::string, uint64_t>> live_ptrs;  // Label and size of each allocation
+    std::unordered_map<std::string, LabelMemory> labels;  // Only labels with live allocations
+
+    void allocated(const char* label, const void* ptr, uint64_t size)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!live_ptrs.try_emplace(ptr, label, size).second) return;
+
+        LabelMemory& label_memory = labels[label];
+        label_memory.live_bytes += static_cast<int64_t>(size);
+        label_memory.live_allocations++;
+
+        allocations++;
+        const int64_t live = live_bytes += static_cast<int64_t>(size);
+        int64_t high_water = high_water_bytes.load();
+        while (live > high_water && !high_water_bytes.compare_exchange_weak(high_water, live)) {}
+    }
+
+    void deallocated(const void* ptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto ptr_it = live_ptrs.find(ptr);
+        if (ptr_it == live_ptrs.end()) return;  // Allocated before the telemetry was enabled
+        const auto& [label, size] = ptr_it->second;
+
+        auto label_it = labels.find(label);
+        if (label_it != labels.end()) {
+            label_it->second.live_bytes -= static_cast<int64_t>(size);
+            if (--label_it->second.live_allocations == 0) {
+                labels.erase(label_it);
+            }
+        }
+
+        deallocations++;
+        live_bytes -= static_cast<int64_t>(size);
+        live_ptrs.erase(ptr_it);
+    }
+};
+
+
+template<typename... Spaces>
+std::array<const char*, sizeof...(Spaces)> memory_space_names(TList<Spaces...>)
+{
+    return { Spaces::name()... };
+}
+
+
+// One for each space of `MemorySpacesList`, in the same order
+const auto mem_spaces_names = memory_space_names(MemorySpacesList{});
+std::array<SpaceMemory, MemorySpacesList::size> mem_spaces_memory;
+
+bool memory_telemetry_enabled = false;
+EventSet memory_previous_events;  // Callbacks replaced by the memory telemetry
+
+
+SpaceMemory* space_memory(const Kokkos::Profiling::SpaceHandle& handle)
+{
+    for (size_t i = 0; i < mem_spaces_names.size(); i++) {
+        if (std::strncmp(mem_spaces_names[i], handle.name, sizeof(handle.name)) == 0) {
+            return &mem_spaces_memory[i];
+        }
+    }
+    return nullptr;
+}
+
+
+void allocate_data(const Kokkos::Profiling::SpaceHandle handle, const char* label, const void* ptr,
+                   const uint64_t size)
+{
+    if (SpaceMemory* memory = space_memory(handle)) {
+        memory->allocated(label, ptr, size);
+    }
+    if (auto previous = memory_previous_events.allocate_data) {
+        previous(handle, label, ptr, size);
+    }
+}
+
+
+void deallocate_data(const Kokkos::Profiling::SpaceHandle handle, const char* label, const void* ptr,
+                     const uint64_t size)
+{
+    if (SpaceMemory* memory = space_memory(handle)) {
+        memory->deallocated(ptr);
+    }
+    if (auto previous = memory_previous_events.deallocate_data) {
+        previous(handle, label, ptr, size);
+    }
+}
+
+
+void enable_memory_telemetry()
+{
+    if (!Kokkos::is_initialized() || Kokkos::is_finalized()) {
+        jl_error("Kokkos must be initialized to enable the memory telemetry");
+    }
+    if (memory_telemetry_enabled) return;
+
+    EventSet events = Kokkos::Tools::Experimental::get_callbacks();
+    memory_previous_events = events;
+    events.allocate_data = allocate_data;
+    events.deallocate_data = deallocate_data;
+    Kokkos::Tools::Experimental::set_callbacks(events);
+    memory_telemetry_enabled = true;
+}
+
+
+void disable_memory_telemetry()
+{
+    if (!memory_telemetry_enabled) return;
+
+    EventSet events = Kokkos::Tools::Experimental::get_callbacks();
+    events.allocate_data = memory_previous_events.allocate_data;
+    events.deallocate_data = memory_previous_events.deallocate_data;
+    Kokkos::Tools::Experimental::set_callbacks(events);
+    memory_telemetry_enabled = false;
+}
+
+
+/**
+ * Snapshot of the memory of all spaces, as a tuple of columns: for each space, its name, live bytes, high-water mark,
+ * and number of allocations and deallocations, then for each label with live allocations, the index (from 0) of its
+ * space, its name, live bytes and number of live allocations.
+ */
+auto memory_telemetry()
+{
+    std::vector<std::string> names;
+    std::vector<int64_t> live, high_water;
+    std::vector<uint64_t> allocations, deallocations;
+
+    std::vector<int> label_spaces;
+    std::vector<std::string> labels;
+    std::vector<int64_t> label_live, label_allocations;
+
+    for (size_t i = 0; i < mem_spaces_memory.size(); i++) {
+        SpaceMemory& memory = mem_spaces_memory[i];
+        std::lock_guard<std::mutex> lock(memory.mutex);
+
+        names.emplace_back(mem_spaces_names[i]);
+        live.push_back(memory.live_bytes.load());
+        high_water.push_back(memory.high_water_bytes.load());
+        allocations.push_back(memory.allocations.load());
+        deallocations.push_back(memory.deallocations.load());
+
+        for (const auto& [label, label_memory] : memory.labels) {
+            label_spaces.push_back(static_cast<int>(i));
+            labels.push_back(label);
+            label_live.push_back(label_memory.live_bytes);
+            label_allocations.push_back(label_memory.live_allocations);
+        }
+    }
+
+    return std::make_tuple(names, live, high_water, allocations, deallocations,
+                           label_spaces, labels, label_live, label_allocations);
+}
+
+
+void reset_memory_high_water()
+{
+    for (SpaceMemory& memory : mem_spaces_memory) {
+        memory.high_water_bytes = memory.live_bytes.load();
+    }
+}
+
+
+/**
+ * `(rss, free, total)`: the resident set size of the process, and the available and total memory of the system, in
+ * bytes. The RSS and available memory are read from '/proc' on Linux, `0` is returned when they are not available.
+ */
+std::tuple<uint64_t, uint64_t, uint64_t> host_memory_info()
+{
+    const auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const uint64_t total = static_cast<uint64_t>(sysconf(_SC_PHYS_PAGES)) * page_size;
+    uint64_t rss = 0, free = 0;
+
+#ifdef __linux__
+    if (FILE* statm = std::fopen("/proc/self/statm", "r")) {
+        unsigned long long size, resident;
+        if (std::fscanf(statm, "%llu %llu", &size, &resident) == 2) {
+            rss = resident * page_size;
+        }
+        std::fclose(statm);
+    }
+
+    if (FILE* meminfo = std::fopen("/proc/meminfo", "r")) {
+        char line[256];
+        unsigned long long available_kb;
+        while (std::fgets(line, sizeof(line), meminfo)) {
+            if (std::sscanf(line, "MemAvailable: %llu kB", &available_kb) == 1) {
+                free = available_kb * 1024;
+                break;
+            }
+        }
+        std::fclose(meminfo);
+    }
+#endif // __linux__
+
+#ifdef _SC_AVPHYS_PAGES
+    if (free == 0) {
+        free = static_cast<uint64_t>(sysconf(_SC_AVPHYS_PAGES)) * page_size;
+    }
+#endif // _SC_AVPHYS_PAGES
+
+    return std::make_tuple(rss, free, total);
+}
+
+} // namespace
+
+
+void define_profiling(jlcxx::Module& mod)
+{
+    // Called from 'Kokkos.Wrapper.Impl', the public functions are defined in 'Kokkos/src/profiling.jl'
+    mod.method("__enable_kernel_profiler", &enable_kernel_profiler);
+    mod.method("__disable_kernel_profiler", &disable_kernel_profiler);
+    mod.method("__kernel_profiler_enabled", [](){ return kernel_profiler_enabled; });
+    mod.method("__kernel_profile", &kernel_profile);
+    mod.method("__reset_kernel_profile", &reset_kernel_profile);
+
+    mod.method("__enable_memory_telemetry", &enable_memory_telemetry);
+    mod.method("__disable_memory_telemetry", &disable_memory_telemetry);
+    mod.method("__memory_telemetry_enabled", [](){ return memory_telemetry_enabled; });
+    mod.method("__memory_telemetry", &memory_telemetry);
+    mod.method("__reset_memory_high_water", &reset_memory_high_water);
+    mod.method("__host_memory_info", &host_memory_info);
+}
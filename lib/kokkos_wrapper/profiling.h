@@ -0,0 +1,10 @@
+
+#ifndef KOKKOS_WRAPPER_PROFILING_H
+#define KOKKOS_WRAPPER_PROFILING_H
+
+#include "jlcxx/jlcxx.hpp"
+
+
+void define_profiling(jlcxx::Module& mod);
+
+#endif //KOKKOS_WRAPPER_PROFILING_H
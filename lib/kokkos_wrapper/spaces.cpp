@@ -6,6 +6,42 @@
 #include "layouts.h"
 
 
+/**
+ * Non-blocking query of the completion of all work submitted to `exec_space`: 1 if complete, 0 if not, and -1 if the
+ * backend has no such query.
+ */
+template<typename Space>
+int8_t query_completion([[maybe_unused]] const Space& exec_space)
+{
+#ifdef KOKKOS_ENABLE_CUDA
+    if constexpr (std::is_same_v<Space, Kokkos::Cuda>) {
+        return cudaStreamQuery(exec_space.cuda_stream()) == cudaSuccess;
+    } else
+#endif
+#ifdef KOKKOS_ENABLE_HIP
+    if constexpr (std::is_same_v<Space, Kokkos_HIP::HIP>) {
+        return hipStreamQuery(exec_space.hip_stream()) == hipSuccess;
+    } else
+#endif
+    if constexpr (false
+#ifdef KOKKOS_ENABLE_SERIAL
+               || std::is_same_v<Space, Kokkos::Serial>
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+               || std::is_same_v<Space, Kokkos::OpenMP>
+#endif
+#ifdef KOKKOS_ENABLE_THREADS
+               || std::is_same_v<Space, Kokkos::Threads>
+#endif
+    ) {
+        // Host backends (except HPX) complete all work before returning to the caller
+        return 1;
+    } else {
+        return -1;
+    }
+}
+
+
 template<typename Space>
 void register_space(jlcxx::Module& mod, jl_module_t* spaces_module)
 {
@@ -29,9 +65,46 @@ void register_space(jlcxx::Module& mod, jl_module_t* spaces_module)
     if constexpr (Kokkos::is_memory_space<Space>::value) {
         space_type.method("allocate", [](const Space& s, ptrdiff_t size) { return s.allocate(size); });
         space_type.method("deallocate", [](const Space& s, void* ptr, ptrdiff_t size) { return s.deallocate(ptr, size); });
+        space_type.method("allocate", [](const Space& s, const std::string& label, ptrdiff_t size) {
+            return s.allocate(label.c_str(), size);
+        });
+        space_type.method("deallocate", [](const Space& s, const std::string& label, void* ptr, ptrdiff_t size) {
+            return s.deallocate(label.c_str(), ptr, size);
+        });
+        space_type.method("__relabel_allocation", [](const Space& s, void* ptr, ptrdiff_t size,
+                                                     const std::string& old_label, const std::string& new_label) {
+            // Seen by Kokkos Tools as a deallocation followed by an allocation, but no memory is freed
+            const Kokkos::Profiling::SpaceHandle handle = Kokkos::Profiling::make_space_handle(s.name());
+            Kokkos::Profiling::deallocateData(handle, old_label, ptr, size);
+            Kokkos::Profiling::allocateData(handle, new_label, ptr, size);
+        });
     } else if constexpr (Kokkos::is_execution_space<Space>::value) {
         space_type.method("concurrency", [](const Space& s){ return s.concurrency(); });  // Serial::concurrency is static, while OpenMP::concurrency is not
         space_type.method("fence", &Space::fence);
+        space_type.method("__fence_gc_safe", [](const Space& s) {
+            // Other Julia threads may run the GC while this thread is blocked in the fence
+            const int8_t gc_state = jl_gc_safe_enter(jl_current_task->ptls);
+            try {
+                s.fence();
+            } catch (...) {
+                jl_gc_safe_leave(jl_current_task->ptls, gc_state);
+                throw;
+            }
+            jl_gc_safe_leave(jl_current_task->ptls, gc_state);
+        });
+        space_type.method("__query_completion", &query_completion<Space>);
+        space_type.method("__partition_space", [](const Space& s, jlcxx::ArrayRef<double> weights) {
+#if KOKKOS_VERSION_CMP(>=, 4, 0, 0)
+            std::vector<double> weights_vec(weights.begin(), weights.end());
+            jlcxx::Array<Space> instances;
+            for (const Space& instance : Kokkos::Experimental::partition_space(s, weights_vec)) {
+                instances.push_back(instance);
+            }
+            return instances;
+#else
+            throw std::runtime_error("`partition_space` requires Kokkos 4.0 or above");
+#endif // KOKKOS_VERSION_CMP(>=, 4, 0, 0)
+        });
     }
 
     mod.method("kokkos_name", [](jlcxx::SingletonType<SpaceInfo<Space>>) { return std::string(Space::name()); });
@@ -152,8 +225,12 @@ void import_all_spaces_methods(jl_module_t* impl_module, jl_module_t* spaces_mod
     const std::array declared_methods = {
         "allocate",
         "deallocate",
+        "__relabel_allocation",
         "concurrency",
         "fence",
+        "__fence_gc_safe",
+        "__query_completion",
+        "__partition_space",
         "kokkos_name",
         "enabled",
         "impl_space_type",
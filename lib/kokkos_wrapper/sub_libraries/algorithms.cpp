@@ -0,0 +1,208 @@
+#include "views.h"
+#include "execution_spaces.h"
+#include "utils.h"
+#include "julia_math.h"
+
+#include <Kokkos_StdAlgorithms.hpp>
+
+
+namespace KE = Kokkos::Experimental;
+
+
+/**
+ * Comparison predicates against a value, their values must match `Kokkos.Views._PREDICATE_OPS`.
+ */
+enum class PredicateOp : int32_t {
+    Equal = 0,
+    NotEqual = 1,
+    Less = 2,
+    LessOrEqual = 3,
+    Greater = 4,
+    GreaterOrEqual = 5,
+};
+
+
+/**
+ * Arithmetic operations with a value, their values must match `Kokkos.Views._TRANSFORM_OPS`.
+ */
+enum class TransformOp : int32_t {
+    Add = 0,
+    Sub = 1,
+    Mul = 2,
+    Div = 3,
+};
+
+
+template<typename T>
+struct JuliaIsEqual
+{
+    KOKKOS_INLINE_FUNCTION bool operator()(const T& a, const T& b) const { return julia_isequal(a, b); }
+};
+
+
+template<typename T>
+struct JuliaIsLess
+{
+    KOKKOS_INLINE_FUNCTION bool operator()(const T& a, const T& b) const { return julia_isless(a, b); }
+};
+
+
+template<typename T>
+struct ComparePredicate
+{
+    PredicateOp op;
+    T value;
+
+    KOKKOS_INLINE_FUNCTION bool operator()(const T& x) const
+    {
+        switch (op) {
+        case PredicateOp::Equal:          return x == value;
+        case PredicateOp::NotEqual:       return x != value;
+        case PredicateOp::Less:           return x < value;
+        case PredicateOp::LessOrEqual:    return x <= value;
+        case PredicateOp::Greater:        return x > value;
+        case PredicateOp::GreaterOrEqual: return x >= value;
+        default:                          return false;
+        }
+    }
+};
+
+
+template<typename T>
+struct ArithmeticTransform
+{
+    TransformOp op;
+    T value;
+
+    KOKKOS_INLINE_FUNCTION T operator()(const T& x) const
+    {
+        switch (op) {
+        case TransformOp::Add: return x + value;
+        case TransformOp::Sub: return x - value;
+        case TransformOp::Mul: return x * value;
+        case TransformOp::Div: return x / value;
+        default:               return x;
+        }
+    }
+};
+
+
+template<typename ExecSpace, typename View>
+void register_fill(jlcxx::Module& mod)
+{
+    using T = typename View::type;
+
+    mod.method("_fill", [](const ExecSpace& exec_space, const View& view, T value)
+    {
+        const typename View::kokkos_view_t k_view = view;
+        if constexpr (View::dim == 1) {
+            KE::fill(exec_space, k_view, value);
+        } else {
+            // The std algorithms are only for 1D views
+            Kokkos::deep_copy(exec_space, k_view, value);
+        }
+        exec_space.fence("Kokkos.jl::fill");
+    });
+}
+
+
+template<typename ExecSpace, typename View>
+void register_1D_algorithms(jlcxx::Module& mod)
+{
+    using T = typename View::type;
+    using KView = typename View::kokkos_view_t;
+
+    mod.method("_copy_if",
+    [](const ExecSpace& exec_space, const View& dest, const View& src, int32_t op, T value)
+    {
+        const KView k_dest = dest;
+        auto last = KE::copy_if(exec_space, KView(src), k_dest, ComparePredicate<T>{ PredicateOp(op), value });
+        exec_space.fence("Kokkos.jl::copy_if");
+        return int64_t(KE::distance(KE::begin(k_dest), last));
+    });
+
+    mod.method("_find_if", [](const ExecSpace& exec_space, const View& view, int32_t op, T value)
+    {
+        const KView k_view = view;
+        auto it = KE::find_if(exec_space, k_view, ComparePredicate<T>{ PredicateOp(op), value });
+        exec_space.fence("Kokkos.jl::find_if");
+        return int64_t(KE::distance(KE::begin(k_view), it));
+    });
+
+    mod.method("_transform",
+    [](const ExecSpace& exec_space, const View& dest, const View& src, int32_t op, T value)
+    {
+        KE::transform(exec_space, KView(src), KView(dest), ArithmeticTransform<T>{ TransformOp(op), value });
+        exec_space.fence("Kokkos.jl::transform");
+    });
+
+    mod.method("_is_sorted", [](const ExecSpace& exec_space, const View& view)
+    {
+        // Sorted like Julia's `issorted`, for consecutive duplicates to be `isequal`
+        const bool sorted = KE::is_sorted(exec_space, KView(view), JuliaIsLess<T>{});
+        exec_space.fence("Kokkos.jl::is_sorted");
+        return sorted;
+    });
+
+    mod.method("_unique", [](const ExecSpace& exec_space, const View& view)
+    {
+        const KView k_view = view;
+        auto last = KE::unique(exec_space, k_view, JuliaIsEqual<T>{});
+        exec_space.fence("Kokkos.jl::unique");
+        return int64_t(KE::distance(KE::begin(k_view), last));
+    });
+
+    mod.method("_reverse", [](const ExecSpace& exec_space, const View& view)
+    {
+        KE::reverse(exec_space, KView(view));
+        exec_space.fence("Kokkos.jl::reverse");
+    });
+}
+
+
+template<typename ExecSpace, typename View>
+void register_algorithms(jlcxx::Module& mod)
+{
+    using T = typename View::type;
+
+    constexpr bool is_arithmetic = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+    constexpr bool is_accessible = Kokkos::SpaceAccessibility<ExecSpace, typename View::mem_space>::accessible;
+
+    if constexpr (!is_accessible) {
+        mod.method("_fill", [](const ExecSpace&, const View&, T) {
+            jl_errorf("`%s` cannot access views of type `%s`",
+                      jl_typename_str((jl_value_t*) jlcxx::julia_type<ExecSpace>()->super->super),
+                      jl_typename_str((jl_value_t*) jlcxx::julia_type<View>()));
+        });
+    } else {
+        register_fill<ExecSpace, View>(mod);
+
+        // Predicates and transforms are only defined for arithmetic types
+        if constexpr (View::dim == 1 && is_arithmetic) {
+            register_1D_algorithms<ExecSpace, View>(mod);
+        }
+    }
+}
+
+
+JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
+{
+    // Called from 'Kokkos.Views.Impl<number>'
+    jl_module_t* views_module = mod.julia_module()->parent;
+    for (const char* name : { "_fill", "_copy_if", "_find_if", "_transform", "_is_sorted", "_unique", "_reverse" }) {
+        jl_module_import(mod.julia_module(), views_module, jl_symbol(name));
+    }
+
+    if constexpr (std::is_void_v<ExecutionSpace>) {
+        jl_errorf("No execution space with the name '" AS_STR(EXEC_SPACE) "'.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else if constexpr (std::is_void_v<MemorySpace>) {
+        jl_errorf("No memory space with the name '" AS_STR(MEM_SPACE) "'\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else {
+        using View = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>;
+        register_algorithms<ExecutionSpace, View>(mod);
+    }
+
+    mod.method("params_string", get_params_string);
+}
@@ -0,0 +1,83 @@
+#include "views.h"
+#include "execution_spaces.h"
+#include "utils.h"
+#include "view_indexing.h"
+#include "julia_math.h"
+
+
+// Namespace of the math functions used in `BROADCAST_EXPR`
+#if KOKKOS_VERSION_CMP(>=, 4, 0, 0)
+namespace broadcast_math = Kokkos;
+#else
+namespace broadcast_math = Kokkos::Experimental;
+#endif
+
+
+// Operands of `BROADCAST_EXPR`, built by `Kokkos.Views._broadcast_expr`
+#define BC_VIEW(n) view_at(k_views[n], idx)
+#define BC_SCALAR(n) k_scalars[n]
+
+
+/**
+ * `Arg`, for each `I` of a parameter pack.
+ */
+template<typename Arg, size_t I>
+using Repeat = Arg;
+
+
+/**
+ * Fused kernel of the broadcast expression `BROADCAST_EXPR`: `dest .= expr(views..., scalars...)`, with all views of
+ * the same type and extents as `dest`.
+ */
+template<typename ExecSpace, typename View, size_t... VI, size_t... SI>
+void register_broadcast(jlcxx::Module& mod, std::index_sequence<VI...>, std::index_sequence<SI...>)
+{
+    using T = typename View::type;
+    using Layout = typename View::layout;
+    using KView = typename View::kokkos_view_t;
+    constexpr size_t D = View::dim;
+
+    mod.method("_broadcast_kernel",
+    [](const ExecSpace& exec_space, const View& dest, Repeat<const View&, VI>... views, Repeat<T, SI>... scalars)
+    {
+        int64_t total;
+        const Indices dims = view_extents(dest, total);
+        const KView k_dest = dest;
+        const Kokkos::Array<KView, sizeof...(VI)> k_views{ KView(views)... };
+        const Kokkos::Array<T, sizeof...(SI)> k_scalars{ scalars... };
+
+        Kokkos::parallel_for("Kokkos.jl::broadcast", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, total),
+        KOKKOS_LAMBDA(const int64_t i) {
+            const Indices idx = linear_to_indices<Layout, D>(i, dims);
+            k_dest.access(idx[0], idx[1], idx[2], idx[3], idx[4], idx[5], idx[6], idx[7]) = T(BROADCAST_EXPR);
+        });
+        exec_space.fence("Kokkos.jl::broadcast");
+    });
+}
+
+
+JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
+{
+    // Called from 'Kokkos.Views.Impl<number>'. `_broadcast_kernel` is not imported from `Kokkos.Views`: each expression
+    // has its own kernel, retrieved from this module.
+
+    if constexpr (std::is_void_v<ExecutionSpace>) {
+        jl_errorf("No execution space with the name '" AS_STR(EXEC_SPACE) "'.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else if constexpr (std::is_void_v<MemorySpace>) {
+        jl_errorf("No memory space with the name '" AS_STR(MEM_SPACE) "'\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else if constexpr (!std::is_floating_point_v<VIEW_TYPE>) {
+        jl_errorf("Broadcast kernels are only compiled for views of floats.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else if constexpr (!Kokkos::SpaceAccessibility<ExecutionSpace, MemorySpace>::accessible) {
+        jl_errorf("The execution space '" AS_STR(EXEC_SPACE) "' cannot access the memory space '" AS_STR(MEM_SPACE) "'.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else {
+        using View = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>;
+        register_broadcast<ExecutionSpace, View>(mod,
+            std::make_index_sequence<BROADCAST_VIEWS>{}, std::make_index_sequence<BROADCAST_SCALARS>{});
+    }
+
+    mod.method("params_string", get_params_string);
+}
@@ -15,12 +15,12 @@ using deep_copyable_t = decltype(Kokkos::deep_copy(ExecSpace{}, DstView{}, SrcVi
 
 template<
         typename Type, typename Dim,
-        typename SrcLayout, typename SrcMemSpace,
-        typename DstLayout, typename DstMemSpace>
+        typename SrcLayout, typename SrcMemSpace, typename SrcMemTraits,
+        typename DstLayout, typename DstMemSpace, typename DstMemTraits>
 void register_deep_copy_method_without_exec_space(jlcxx::Module& mod)
 {
-    using SrcView = ViewWrap<Type, Dim, SrcLayout, SrcMemSpace>;
-    using DestView = ViewWrap<Type, Dim, DstLayout, DstMemSpace>;
+    using SrcView = ViewWrap<Type, Dim, SrcLayout, SrcMemSpace, SrcMemTraits>;
+    using DestView = ViewWrap<Type, Dim, DstLayout, DstMemSpace, DstMemTraits>;
 
     constexpr bool is_deep_copyable = Kokkos::is_detected<deep_copyable_no_exec_t, DestView, SrcView>::value;
 
@@ -40,17 +40,18 @@ void register_deep_copy_method_without_exec_space(jlcxx::Module& mod)
 
 template<
         typename Type, typename Dim,
-        typename SrcLayout, typename SrcMemSpace,
-        typename DstLayout, typename DstMemSpace,
+        typename SrcLayout, typename SrcMemSpace, typename SrcMemTraits,
+        typename DstLayout, typename DstMemSpace, typename DstMemTraits,
         typename ExecSpace>
 void register_deep_copy_method_with_exec_space(jlcxx::Module& mod)
 {
-    using SrcView = ViewWrap<Type, Dim, SrcLayout, SrcMemSpace>;
-    using DestView = ViewWrap<Type, Dim, DstLayout, DstMemSpace>;
+    using SrcView = ViewWrap<Type, Dim, SrcLayout, SrcMemSpace, SrcMemTraits>;
+    using DestView = ViewWrap<Type, Dim, DstLayout, DstMemSpace, DstMemTraits>;
 
     constexpr bool is_deep_copyable = Kokkos::is_detected<deep_copyable_t, ExecSpace, DestView, SrcView>::value;
 
-    mod.method("deep_copy",
+    // Wrapped by `Kokkos.Views.deep_copy`, which returns a completion handle
+    mod.method("_deep_copy",
     [](const ExecSpace& exec_space, const DestView& dest_view, const SrcView& src_view)
     {
         if constexpr (is_deep_copyable) {
@@ -69,18 +70,27 @@ JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
 {
     // Called from 'Kokkos.Views.Impl<number>'
     jl_module_t* views_module = mod.julia_module()->parent;
-    jl_module_import(mod.julia_module(), views_module, jl_symbol("deep_copy"));
+    for (const char* name : { "deep_copy", "_deep_copy" }) {
+        jl_module_import(mod.julia_module(), views_module, jl_symbol(name));
+    }
 
     if constexpr (std::is_void_v<DestMemorySpace>) {
         jl_errorf("No memory space with the name '" AS_STR(DEST_MEM_SPACE) "' for the destination memory space.\n"
                   "Compilation parameters:\n%s", get_params_string());
     } else if constexpr (WITHOUT_EXEC_SPACE_ARG == 1) {
-        register_deep_copy_method_without_exec_space<VIEW_TYPE, Dimension, Layout, MemorySpace, DestLayout, DestMemorySpace>(mod);
+        register_deep_copy_method_without_exec_space<
+                VIEW_TYPE, Dimension,
+                Layout, MemorySpace, MemTraits,
+                DestLayout, DestMemorySpace, DestMemTraits>(mod);
     } else if constexpr (std::is_void_v<ExecutionSpace>) {
         jl_errorf("No execution space with the name '" AS_STR(EXEC_SPACE) "'.\n"
                   "Compilation parameters:\n%s", get_params_string());
     } else {
-        register_deep_copy_method_with_exec_space<VIEW_TYPE, Dimension, Layout, MemorySpace, DestLayout, DestMemorySpace, ExecutionSpace>(mod);
+        register_deep_copy_method_with_exec_space<
+                VIEW_TYPE, Dimension,
+                Layout, MemorySpace, MemTraits,
+                DestLayout, DestMemorySpace, DestMemTraits,
+                ExecutionSpace>(mod);
     }
 
     mod.method("params_string", get_params_string);
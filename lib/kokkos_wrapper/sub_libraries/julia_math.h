@@ -0,0 +1,98 @@
+#ifndef KOKKOS_WRAPPER_JULIA_MATH_H
+#define KOKKOS_WRAPPER_JULIA_MATH_H
+
+#include "Kokkos_Core.hpp"
+#include "kokkos_utils.h"
+
+#include <type_traits>
+
+
+/**
+ * Math functions with the semantics of their Julia equivalent, usable in kernels of the sub-libraries.
+ */
+
+
+// Namespace of the Kokkos math functions
+#if KOKKOS_VERSION_CMP(>=, 4, 0, 0)
+namespace kokkos_math = Kokkos;
+#else
+namespace kokkos_math = Kokkos::Experimental;
+#endif
+
+
+/**
+ * Julia's `min`: `NaN` if any argument is `NaN` (unlike `fmin` and `Kokkos::Min`), and `-0.0 < 0.0`.
+ */
+template<typename T>
+KOKKOS_INLINE_FUNCTION T julia_min(T a, T b)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        if (a != a || b != b) return a + b;
+        if (a == b) return kokkos_math::signbit(a) ? a : b;
+    }
+    return a < b ? a : b;
+}
+
+
+/**
+ * Julia's `max`: `NaN` if any argument is `NaN` (unlike `fmax` and `Kokkos::Max`), and `-0.0 < 0.0`.
+ */
+template<typename T>
+KOKKOS_INLINE_FUNCTION T julia_max(T a, T b)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        if (a != a || b != b) return a + b;
+        if (a == b) return kokkos_math::signbit(a) ? b : a;
+    }
+    return a > b ? a : b;
+}
+
+
+/**
+ * Julia's `abs`: for signed integers, `abs(typemin(T)) == typemin(T)` instead of an overflow.
+ */
+template<typename T>
+KOKKOS_INLINE_FUNCTION T julia_abs(T x)
+{
+    if constexpr (std::is_unsigned_v<T>) {
+        return x;
+    } else if constexpr (std::is_integral_v<T>) {
+        using U = std::make_unsigned_t<T>;
+        return x < T(0) ? static_cast<T>(U(0) - static_cast<U>(x)) : x;
+    } else {
+        return kokkos_math::fabs(x);
+    }
+}
+
+
+/**
+ * Julia's `isequal`: `NaN`s are equal to each other, and `-0.0` is not equal to `0.0`.
+ */
+template<typename T>
+KOKKOS_INLINE_FUNCTION bool julia_isequal(T a, T b)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        if (a != a || b != b) return a != a && b != b;
+        return a == b && kokkos_math::signbit(a) == kokkos_math::signbit(b);
+    } else {
+        return a == b;
+    }
+}
+
+
+/**
+ * Julia's `isless`: `NaN`s are greater than any other value, and `-0.0 < 0.0`.
+ */
+template<typename T>
+KOKKOS_INLINE_FUNCTION bool julia_isless(T a, T b)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        if (a != a) return false;
+        if (b != b) return true;
+        return a < b || (a == b && kokkos_math::signbit(a) && !kokkos_math::signbit(b));
+    } else {
+        return a < b;
+    }
+}
+
+#endif //KOKKOS_WRAPPER_JULIA_MATH_H
@@ -0,0 +1,72 @@
+#include "views.h"
+#include "execution_spaces.h"
+#include "utils.h"
+
+/*
+ * Generated by `Kokkos.Views.compile_kernel` in the build directory of this instance, defines:
+ *  - `KERNEL_LABEL`: the label of the kernel
+ *  - `KERNEL_IS_REDUCTION`: `1` for a `Kokkos::parallel_reduce`, `0` for a `Kokkos::parallel_for`
+ *  - `KERNEL_REDUCER`: template of the reducer of `KernelResult` (e.g. `Kokkos::Sum`), for reductions only
+ *  - `KernelResult`: the type of the result of the reduction, for reductions only
+ *  - `KernelParams`: a `TList` of the parameters of the kernel, `const View&` for views or scalars
+ *  - `Kernel`: the functor of the kernel, constructible from `KernelParams`, with the user code as its body
+ */
+#if __has_include("kernel_source.h")
+#include "kernel_source.h"
+#else
+// Default kernel to work with an IDE: `a(i) *= alpha` over `View{double, 1, LayoutLeft, MemorySpace}`
+#define KERNEL_LABEL "Kokkos.jl::kernel::default"
+#define KERNEL_IS_REDUCTION 0
+using KernelArg1 = ViewWrap<double, std::integral_constant<int, 1>, Kokkos::LayoutLeft, MemorySpace>;
+using KernelParams = TList<const KernelArg1&, double>;
+struct Kernel {
+    typename KernelArg1::kokkos_view_t a;
+    double alpha;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const int64_t i) const { a(i) *= alpha; }
+};
+#endif
+
+
+template<typename ExecSpace, typename... Params>
+void register_kernel(jlcxx::Module& mod, TList<Params...>)
+{
+#if KERNEL_IS_REDUCTION
+    mod.method("kernel", [](const ExecSpace& exec_space, int64_t n, Params... params)
+    {
+        const Kernel kernel{ params... };
+        KernelResult result;
+        Kokkos::parallel_reduce(KERNEL_LABEL, Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+                                kernel, KERNEL_REDUCER<KernelResult>(result));
+        exec_space.fence(KERNEL_LABEL);
+        return result;
+    });
+#else
+    mod.method("kernel", [](const ExecSpace& exec_space, int64_t n, Params... params)
+    {
+        const Kernel kernel{ params... };
+        Kokkos::parallel_for(KERNEL_LABEL, Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n), kernel);
+        exec_space.fence(KERNEL_LABEL);
+    });
+#endif
+}
+
+
+JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
+{
+    // Called from 'Kokkos.Views.Impl<number>'. `kernel` is not imported from `Kokkos.Views`: each kernel is retrieved
+    // from its own module.
+
+    if constexpr (std::is_void_v<ExecutionSpace>) {
+        jl_errorf("No execution space with the name '" AS_STR(EXEC_SPACE) "'.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else if constexpr (!std::is_void_v<MemorySpace>
+                         && !Kokkos::SpaceAccessibility<ExecutionSpace, MemorySpace>::accessible) {
+        jl_errorf("The execution space '" AS_STR(EXEC_SPACE) "' cannot access the memory space '" AS_STR(MEM_SPACE) "'.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else {
+        register_kernel<ExecutionSpace>(mod, KernelParams{});
+    }
+
+    mod.method("params_string", get_params_string);
+}
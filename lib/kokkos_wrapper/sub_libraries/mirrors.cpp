@@ -10,7 +10,7 @@ struct Nothing_t {};  // Mapped to `Core.Nothing`
 template<typename SrcView, typename DstMemSpace>
 void register_mirror_methods_with_dest_space(jlcxx::Module& mod)
 {
-    using MirrorView = typename SrcView::template with_mem_space<DstMemSpace>;
+    using MirrorView = typename SrcView::template mirror_view_t<DstMemSpace>;
 
     mod.method("create_mirror",
     [](const SrcView& src_view, const DstMemSpace& dst_space, bool init)
@@ -46,11 +46,11 @@ void register_mirror_methods_default_dest_space(jlcxx::Module& mod)
         if (init) {
             auto view_mirror = Kokkos::create_mirror(src_view);
             using default_dst_space = typename decltype(view_mirror)::memory_space;
-            return typename SrcView::template with_mem_space<default_dst_space>(std::move(view_mirror));
+            return typename SrcView::template mirror_view_t<default_dst_space>(std::move(view_mirror));
         } else {
             auto view_mirror = Kokkos::create_mirror(Kokkos::WithoutInitializing, src_view);
             using default_dst_space = typename decltype(view_mirror)::memory_space;
-            return typename SrcView::template with_mem_space<default_dst_space>(std::move(view_mirror));
+            return typename SrcView::template mirror_view_t<default_dst_space>(std::move(view_mirror));
         }
     });
 
@@ -58,12 +58,12 @@ void register_mirror_methods_default_dest_space(jlcxx::Module& mod)
         if (init) {
             auto view_mirror = Kokkos::create_mirror_view(src_view);
             using default_dst_space = typename decltype(view_mirror)::memory_space;
-            return typename SrcView::template with_mem_space<default_dst_space>(std::move(view_mirror));
+            return typename SrcView::template mirror_view_t<default_dst_space>(std::move(view_mirror));
         }
         else {
             auto view_mirror = Kokkos::create_mirror_view(Kokkos::WithoutInitializing, src_view);
             using default_dst_space = typename decltype(view_mirror)::memory_space;
-            return typename SrcView::template with_mem_space<default_dst_space>(std::move(view_mirror));
+            return typename SrcView::template mirror_view_t<default_dst_space>(std::move(view_mirror));
         }
     });
 }
@@ -84,13 +84,13 @@ JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
         jl_errorf("No memory space with the name '" AS_STR(MEM_SPACE) "'\n"
                   "Compilation parameters:\n%s", get_params_string());
     } else if constexpr (WITH_NOTHING_ARG == 1) {
-        using SrcView = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace>;
+        using SrcView = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>;
         register_mirror_methods_default_dest_space<SrcView>(mod);
     } else if constexpr (std::is_void_v<DestMemorySpace>) {
         jl_errorf("No memory space with the name '" AS_STR(DEST_MEM_SPACE) "' for destination space\n"
                   "Compilation parameters:\n%s", get_params_string());
     } else {
-        using SrcView = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace>;
+        using SrcView = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>;
         register_mirror_methods_with_dest_space<SrcView, DestMemorySpace>(mod);
     }
 
@@ -0,0 +1 @@
+// Empty source of the 'sub_libraries_pch' target, which only builds the precompiled header 'precompiled.h'.
@@ -0,0 +1,28 @@
+
+#ifndef KOKKOS_WRAPPER_PRECOMPILED_H
+#define KOKKOS_WRAPPER_PRECOMPILED_H
+
+/**
+ * Headers shared by all sub-libraries, precompiled once alongside the wrapper library and reused by all instances.
+ * Only headers which do not depend on the parameters of 'build_parameters.h' can be included here.
+ */
+
+#include "jlcxx/jlcxx.hpp"
+#include "jlcxx/tuple.hpp"
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Sort.hpp"
+#include "Kokkos_StdAlgorithms.hpp"
+
+#include "utils.h"
+#include "kokkos_utils.h"
+#include "spaces.h"
+#include "printing_utils.h"
+
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+#endif //KOKKOS_WRAPPER_PRECOMPILED_H
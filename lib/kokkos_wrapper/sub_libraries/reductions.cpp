@@ -0,0 +1,363 @@
+#include "views.h"
+#include "execution_spaces.h"
+#include "utils.h"
+#include "view_indexing.h"
+#include "julia_math.h"
+
+
+/**
+ * Reduction operations, their values must match the ones of `Kokkos.Views.ReductionOp`.
+ */
+enum class ReductionOp : int32_t {
+    Sum = 0,
+    Prod = 1,
+    Min = 2,
+    Max = 3,
+    AbsSum = 4,
+    SqSum = 5,
+    AbsMax = 6,
+};
+
+
+template<ReductionOp Op, typename T>
+KOKKOS_INLINE_FUNCTION T transform_value(const T& x)
+{
+    if constexpr (Op == ReductionOp::AbsSum || Op == ReductionOp::AbsMax) {
+        return julia_abs(x);
+    } else if constexpr (Op == ReductionOp::SqSum) {
+        return x * x;
+    } else {
+        return x;
+    }
+}
+
+
+template<ReductionOp Op, typename T>
+KOKKOS_INLINE_FUNCTION void combine(T& acc, const T& x)
+{
+    if constexpr (Op == ReductionOp::Sum || Op == ReductionOp::AbsSum || Op == ReductionOp::SqSum) {
+        acc += x;
+    } else if constexpr (Op == ReductionOp::Prod) {
+        acc *= x;
+    } else if constexpr (Op == ReductionOp::Min) {
+        acc = julia_min(acc, x);
+    } else {
+        acc = julia_max(acc, x);
+    }
+}
+
+
+template<ReductionOp Op, typename T>
+KOKKOS_INLINE_FUNCTION T reduction_identity()
+{
+    if constexpr (Op == ReductionOp::Sum || Op == ReductionOp::AbsSum || Op == ReductionOp::SqSum) {
+        return Kokkos::reduction_identity<T>::sum();
+    } else if constexpr (Op == ReductionOp::Prod) {
+        return Kokkos::reduction_identity<T>::prod();
+    } else if constexpr (std::is_floating_point_v<T>) {
+        // The identities of `Kokkos::Min` and `Kokkos::Max` are the largest finite values, not infinities
+        return Op == ReductionOp::Min ? Kokkos::Experimental::infinity<T>::value
+                                      : -Kokkos::Experimental::infinity<T>::value;
+    } else if constexpr (Op == ReductionOp::Min) {
+        return Kokkos::reduction_identity<T>::min();
+    } else {
+        return Kokkos::reduction_identity<T>::max();
+    }
+}
+
+
+/**
+ * Reducer combining values with `combine<Op>`. Used for the minimum and maximum since `Kokkos::Min` and `Kokkos::Max`
+ * drop NaNs, while Julia propagates them.
+ */
+template<ReductionOp Op, typename T>
+struct CombineReducer {
+    using reducer = CombineReducer;
+    using value_type = T;
+    using result_view_type = Kokkos::View<value_type, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+
+    result_view_type value;
+
+    explicit CombineReducer(value_type& value_) : value(&value_) {}
+
+    KOKKOS_INLINE_FUNCTION void join(value_type& dest, const value_type& src) const { combine<Op>(dest, src); }
+    KOKKOS_INLINE_FUNCTION void init(value_type& val) const { val = reduction_identity<Op, T>(); }
+    KOKKOS_INLINE_FUNCTION value_type& reference() const { return *value.data(); }
+    KOKKOS_INLINE_FUNCTION result_view_type view() const { return value; }
+    KOKKOS_INLINE_FUNCTION bool references_scalar() const { return true; }
+};
+
+
+template<typename T>
+struct MinMaxValue {
+    T min_val;
+    T max_val;
+};
+
+
+/**
+ * Same as `Kokkos::MinMax`, but propagating NaNs.
+ */
+template<typename T>
+struct MinMaxReducer {
+    using reducer = MinMaxReducer;
+    using value_type = MinMaxValue<T>;
+    using result_view_type = Kokkos::View<value_type, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+
+    result_view_type value;
+
+    explicit MinMaxReducer(value_type& value_) : value(&value_) {}
+
+    KOKKOS_INLINE_FUNCTION void join(value_type& dest, const value_type& src) const
+    {
+        combine<ReductionOp::Min>(dest.min_val, src.min_val);
+        combine<ReductionOp::Max>(dest.max_val, src.max_val);
+    }
+
+    KOKKOS_INLINE_FUNCTION void init(value_type& val) const
+    {
+        val.min_val = reduction_identity<ReductionOp::Min, T>();
+        val.max_val = reduction_identity<ReductionOp::Max, T>();
+    }
+
+    KOKKOS_INLINE_FUNCTION value_type& reference() const { return *value.data(); }
+    KOKKOS_INLINE_FUNCTION result_view_type view() const { return value; }
+    KOKKOS_INLINE_FUNCTION bool references_scalar() const { return true; }
+};
+
+
+template<ReductionOp Op, typename T>
+auto make_reducer(T& result)
+{
+    if constexpr (Op == ReductionOp::Sum || Op == ReductionOp::AbsSum || Op == ReductionOp::SqSum) {
+        return Kokkos::Sum<T>(result);
+    } else if constexpr (Op == ReductionOp::Prod) {
+        return Kokkos::Prod<T>(result);
+    } else {
+        return CombineReducer<Op, T>(result);
+    }
+}
+
+
+template<ReductionOp Op, typename ExecSpace, typename View>
+typename View::type reduce_view(const ExecSpace& exec_space, const View& view)
+{
+    using T = typename View::type;
+    using Layout = typename View::layout;
+    constexpr size_t D = View::dim;
+
+    int64_t total;
+    const Indices dims = view_extents(view, total);
+    const typename View::kokkos_view_t k_view = view;
+
+    T result = reduction_identity<Op, T>();
+    Kokkos::parallel_reduce("Kokkos.jl::reduce", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, total),
+    KOKKOS_LAMBDA(const int64_t i, T& acc) {
+        const Indices idx = linear_to_indices<Layout, D>(i, dims);
+        combine<Op>(acc, transform_value<Op>(view_at(k_view, idx)));
+    }, make_reducer<Op>(result));
+
+    return result;
+}
+
+
+template<typename ExecSpace, typename View>
+std::tuple<typename View::type, typename View::type> minmax_view(const ExecSpace& exec_space, const View& view)
+{
+    using T = typename View::type;
+    using Layout = typename View::layout;
+    constexpr size_t D = View::dim;
+
+    int64_t total;
+    const Indices dims = view_extents(view, total);
+    const typename View::kokkos_view_t k_view = view;
+
+    MinMaxValue<T> result;
+    Kokkos::parallel_reduce("Kokkos.jl::minmax", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, total),
+    KOKKOS_LAMBDA(const int64_t i, MinMaxValue<T>& acc) {
+        const Indices idx = linear_to_indices<Layout, D>(i, dims);
+        const T x = view_at(k_view, idx);
+        combine<ReductionOp::Min>(acc.min_val, x);
+        combine<ReductionOp::Max>(acc.max_val, x);
+    }, MinMaxReducer<T>(result));
+
+    return { result.min_val, result.max_val };
+}
+
+
+template<typename ExecSpace, typename View>
+typename View::type dot_views(const ExecSpace& exec_space, const View& a, const View& b)
+{
+    using T = typename View::type;
+    using Layout = typename View::layout;
+    constexpr size_t D = View::dim;
+
+    int64_t total;
+    const Indices dims = view_extents(a, total);
+    const typename View::kokkos_view_t k_a = a;
+    const typename View::kokkos_view_t k_b = b;
+
+    T result = 0;
+    Kokkos::parallel_reduce("Kokkos.jl::dot", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, total),
+    KOKKOS_LAMBDA(const int64_t i, T& acc) {
+        const Indices idx = linear_to_indices<Layout, D>(i, dims);
+        acc += view_at(k_a, idx) * view_at(k_b, idx);
+    }, Kokkos::Sum<T>(result));
+
+    return result;
+}
+
+
+/**
+ * Reduction along the dimension `dim` (starting at 0) of `src`, stored in `dest` which has the same extents as `src`
+ * except along `dim`, where it is 1.
+ *
+ * Each thread reduces sequentially all values along `dim`.
+ */
+template<ReductionOp Op, typename ExecSpace, typename DestView, typename View>
+void reduce_view_dim(const ExecSpace& exec_space, const DestView& dest, const View& src, int64_t dim)
+{
+    using T = typename View::type;
+    using Layout = typename View::layout;
+    constexpr size_t D = View::dim;
+
+    int64_t total;
+    Indices dims = view_extents(src, total);
+    const typename View::kokkos_view_t k_src = src;
+    const typename DestView::kokkos_view_t k_dest = dest;
+
+    const int64_t dim_length = dims[dim];
+    if (dim_length == 0) {
+        Kokkos::deep_copy(exec_space, k_dest, reduction_identity<Op, T>());
+        exec_space.fence("Kokkos.jl::reduce_dim");
+        return;
+    }
+
+    dims[dim] = 1;
+    total /= dim_length;
+
+    Kokkos::parallel_for("Kokkos.jl::reduce_dim", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, total),
+    KOKKOS_LAMBDA(const int64_t i) {
+        Indices idx = linear_to_indices<Layout, D>(i, dims);
+        T acc = reduction_identity<Op, T>();
+        for (int64_t j = 0; j < dim_length; j++) {
+            idx[dim] = j;
+            combine<Op>(acc, transform_value<Op>(view_at(k_src, idx)));
+        }
+        idx[dim] = 0;
+        k_dest.access(idx[0], idx[1], idx[2], idx[3], idx[4], idx[5], idx[6], idx[7]) = acc;
+    });
+
+    exec_space.fence("Kokkos.jl::reduce_dim");
+}
+
+
+template<template<ReductionOp> typename Func, typename... Args>
+auto dispatch_reduction_op(int32_t op, Args&&... args)
+{
+    switch (static_cast<ReductionOp>(op)) {
+    case ReductionOp::Sum:    return Func<ReductionOp::Sum>::call(std::forward<Args>(args)...);
+    case ReductionOp::Prod:   return Func<ReductionOp::Prod>::call(std::forward<Args>(args)...);
+    case ReductionOp::Min:    return Func<ReductionOp::Min>::call(std::forward<Args>(args)...);
+    case ReductionOp::Max:    return Func<ReductionOp::Max>::call(std::forward<Args>(args)...);
+    case ReductionOp::AbsSum: return Func<ReductionOp::AbsSum>::call(std::forward<Args>(args)...);
+    case ReductionOp::SqSum:  return Func<ReductionOp::SqSum>::call(std::forward<Args>(args)...);
+    case ReductionOp::AbsMax: return Func<ReductionOp::AbsMax>::call(std::forward<Args>(args)...);
+    default:
+        jl_errorf("Unknown reduction operation: %d", op);
+    }
+}
+
+
+template<ReductionOp Op>
+struct ReduceView {
+    template<typename ExecSpace, typename View>
+    static auto call(const ExecSpace& exec_space, const View& view) { return reduce_view<Op>(exec_space, view); }
+};
+
+
+template<ReductionOp Op>
+struct ReduceViewDim {
+    template<typename ExecSpace, typename DestView, typename View>
+    static void call(const ExecSpace& exec_space, const DestView& dest, const View& src, int64_t dim)
+    {
+        reduce_view_dim<Op>(exec_space, dest, src, dim);
+    }
+};
+
+
+template<typename ExecSpace, typename View>
+void register_reductions(jlcxx::Module& mod)
+{
+    using T = typename View::type;
+
+    // Views reduced along a dimension are stored in the same layout as the source view, except for `LayoutStride`
+    // which would require strides from the user. Must match `Kokkos.Views._reduce_dims_view_type`.
+    using DestLayout = std::conditional_t<std::is_same_v<typename View::layout, Kokkos::LayoutStride>,
+                                          Kokkos::LayoutLeft, typename View::layout>;
+    using DestView = typename View::template mirror_view_t<typename View::mem_space>::template with_layout<DestLayout>;
+
+    constexpr bool is_reducible = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+    constexpr bool is_accessible = Kokkos::SpaceAccessibility<ExecSpace, typename View::mem_space>::accessible;
+
+    if constexpr (!is_reducible) {
+        auto error = []() {
+            jl_errorf("Reductions are only possible on views of arithmetic types, got: `%s`",
+                      jl_typename_str((jl_value_t*) jlcxx::julia_type<View>()));
+        };
+        mod.method("_reduce", [=](const ExecSpace&, const View&, int32_t) -> T { error(); return T{}; });
+        mod.method("_reduce_minmax", [=](const ExecSpace&, const View&) -> std::tuple<T, T> { error(); return {}; });
+        mod.method("_reduce_dot", [=](const ExecSpace&, const View&, const View&) -> T { error(); return T{}; });
+        mod.method("_reduce_dims", [=](const ExecSpace&, const DestView&, const View&, int64_t, int32_t) { error(); });
+    } else if constexpr (!is_accessible) {
+        auto error = []() {
+            jl_errorf("`%s` cannot access views of type `%s`",
+                      jl_typename_str((jl_value_t*) jlcxx::julia_type<ExecSpace>()->super->super),
+                      jl_typename_str((jl_value_t*) jlcxx::julia_type<View>()));
+        };
+        mod.method("_reduce", [=](const ExecSpace&, const View&, int32_t) -> T { error(); return T{}; });
+        mod.method("_reduce_minmax", [=](const ExecSpace&, const View&) -> std::tuple<T, T> { error(); return {}; });
+        mod.method("_reduce_dot", [=](const ExecSpace&, const View&, const View&) -> T { error(); return T{}; });
+        mod.method("_reduce_dims", [=](const ExecSpace&, const DestView&, const View&, int64_t, int32_t) { error(); });
+    } else {
+        mod.method("_reduce", [](const ExecSpace& exec_space, const View& view, int32_t op) {
+            return dispatch_reduction_op<ReduceView>(op, exec_space, view);
+        });
+
+        mod.method("_reduce_minmax", [](const ExecSpace& exec_space, const View& view) {
+            return minmax_view(exec_space, view);
+        });
+
+        mod.method("_reduce_dot", [](const ExecSpace& exec_space, const View& a, const View& b) {
+            return dot_views(exec_space, a, b);
+        });
+
+        mod.method("_reduce_dims",
+        [](const ExecSpace& exec_space, const DestView& dest, const View& src, int64_t dim, int32_t op) {
+            dispatch_reduction_op<ReduceViewDim>(op, exec_space, dest, src, dim);
+        });
+    }
+}
+
+
+JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
+{
+    // Called from 'Kokkos.Views.Impl<number>'
+    jl_module_t* views_module = mod.julia_module()->parent;
+    for (const char* name : { "_reduce", "_reduce_minmax", "_reduce_dot", "_reduce_dims" }) {
+        jl_module_import(mod.julia_module(), views_module, jl_symbol(name));
+    }
+
+    if constexpr (std::is_void_v<ExecutionSpace>) {
+        jl_errorf("No execution space with the name '" AS_STR(EXEC_SPACE) "'.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else if constexpr (std::is_void_v<MemorySpace>) {
+        jl_errorf("No memory space with the name '" AS_STR(MEM_SPACE) "'\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else {
+        using View = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>;
+        register_reductions<ExecutionSpace, View>(mod);
+    }
+
+    mod.method("params_string", get_params_string);
+}
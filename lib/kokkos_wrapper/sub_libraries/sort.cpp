@@ -0,0 +1,174 @@
+#include "views.h"
+#include "execution_spaces.h"
+#include "utils.h"
+
+#include <Kokkos_Sort.hpp>
+
+
+template<typename ExecSpace, typename View, typename PermView>
+void register_permute(jlcxx::Module& mod)
+{
+    using T = typename View::type;
+    using MemSpace = typename View::mem_space;
+
+    mod.method("_permute", [](const ExecSpace& exec_space, const View& view, const PermView& perm)
+    {
+        const typename View::kokkos_view_t k_view = view;
+        const typename PermView::kokkos_view_t k_perm = perm;
+        const int64_t n = k_view.extent(0);
+
+        // Out of bounds indices are checked before modifying `view`
+        using MinMaxValue = typename Kokkos::MinMax<int64_t>::value_type;
+        MinMaxValue perm_range;
+        Kokkos::parallel_reduce("Kokkos.jl::permute_range", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+        KOKKOS_LAMBDA(const int64_t i, MinMaxValue& acc) {
+            if (k_perm(i) < acc.min_val) acc.min_val = k_perm(i);
+            if (k_perm(i) > acc.max_val) acc.max_val = k_perm(i);
+        }, Kokkos::MinMax<int64_t>(perm_range));
+
+        if (n > 0 && (perm_range.min_val < 1 || perm_range.max_val > n)) {
+            jl_errorf("permutation indices must be in 1:%lld, got indices in %lld:%lld",
+                      (long long) n, (long long) perm_range.min_val, (long long) perm_range.max_val);
+        }
+
+        Kokkos::View<T*, MemSpace> tmp(Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing, "permute_tmp"),
+                                       k_view.extent(0));
+        Kokkos::deep_copy(exec_space, tmp, k_view);
+
+        Kokkos::parallel_for("Kokkos.jl::permute", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, k_view.extent(0)),
+        KOKKOS_LAMBDA(const int64_t i) {
+            k_view(i) = tmp(k_perm(i) - 1);
+        });
+        exec_space.fence("Kokkos.jl::permute");
+    });
+}
+
+
+template<typename ExecSpace, typename View, typename PermView>
+void register_sort_methods(jlcxx::Module& mod)
+{
+    using T = typename View::type;
+    using KView = typename View::kokkos_view_t;
+    using KPermView = typename PermView::kokkos_view_t;
+
+    mod.method("_sort", [](const ExecSpace& exec_space, const View& view)
+    {
+        Kokkos::sort(exec_space, KView(view));
+        exec_space.fence("Kokkos.jl::sort");
+    });
+
+    mod.method("_bin_sort",
+    [](const ExecSpace& exec_space, const View& keys, const PermView& perm,
+       int64_t bin_count, bool sort_within_bins, bool sort_keys)
+    {
+        const KView k_keys = keys;
+        const KPermView k_perm = perm;
+        const int64_t n = k_keys.extent(0);
+
+        if constexpr (std::is_floating_point_v<T>) {
+            // NaNs cannot be placed in a bin: `BinOp1D` would give them an invalid bin index
+            int64_t nan_count = 0;
+            Kokkos::parallel_reduce("Kokkos.jl::bin_sort_nans", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+            KOKKOS_LAMBDA(const int64_t i, int64_t& acc) {
+                if (k_keys(i) != k_keys(i)) acc++;
+            }, Kokkos::Sum<int64_t>(nan_count));
+
+            if (nan_count > 0) {
+                jl_errorf("`bin_sort` keys cannot contain NaNs, got %lld NaN keys", (long long) nan_count);
+            }
+        }
+
+        using MinMaxValue = typename Kokkos::MinMax<T>::value_type;
+        MinMaxValue key_range;
+        Kokkos::parallel_reduce("Kokkos.jl::bin_sort_range", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+        KOKKOS_LAMBDA(const int64_t i, MinMaxValue& acc) {
+            if (k_keys(i) < acc.min_val) acc.min_val = k_keys(i);
+            if (k_keys(i) > acc.max_val) acc.max_val = k_keys(i);
+        }, Kokkos::MinMax<T>(key_range));
+
+        if (n == 0 || !(key_range.min_val < key_range.max_val)) {
+            // All keys are equal (or there is none): `BinOp1D` cannot be built, and the keys are already sorted
+            Kokkos::parallel_for("Kokkos.jl::bin_sort_identity", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+            KOKKOS_LAMBDA(const int64_t i) { k_perm(i) = i + 1; });
+            exec_space.fence("Kokkos.jl::bin_sort");
+            return;
+        }
+
+        using BinOp = Kokkos::BinOp1D<KView>;
+        BinOp bin_op(bin_count, key_range.min_val, key_range.max_val);
+#if KOKKOS_VERSION_CMP(>=, 4, 1, 0)
+        Kokkos::BinSort<KView, BinOp, ExecSpace> bin_sort(exec_space, k_keys, bin_op, sort_within_bins);
+        bin_sort.create_permute_vector(exec_space);
+#else
+        Kokkos::BinSort<KView, BinOp, ExecSpace> bin_sort(k_keys, bin_op, sort_within_bins);
+        bin_sort.create_permute_vector();
+#endif
+
+        const auto permute_vector = bin_sort.get_permute_vector();
+        Kokkos::parallel_for("Kokkos.jl::bin_sort_perm", Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n),
+        KOKKOS_LAMBDA(const int64_t i) { k_perm(i) = int64_t(permute_vector(i)) + 1; });
+
+        if (sort_keys) {
+#if KOKKOS_VERSION_CMP(>=, 4, 1, 0)
+            bin_sort.sort(exec_space, k_keys);
+#else
+            bin_sort.sort(k_keys);
+#endif
+        }
+
+        exec_space.fence("Kokkos.jl::bin_sort");
+    });
+}
+
+
+template<typename ExecSpace, typename View>
+void register_sort(jlcxx::Module& mod)
+{
+    using T = typename View::type;
+    using MemSpace = typename View::mem_space;
+
+    // Permutation views, with 1-based indices. Must match `Kokkos.Views._perm_view_type`.
+    using PermView = ViewWrap<int64_t, std::integral_constant<int, 1>, Kokkos::LayoutLeft, MemSpace>;
+
+    constexpr bool is_accessible = Kokkos::SpaceAccessibility<ExecSpace, MemSpace>::accessible;
+    constexpr bool is_sortable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    if constexpr (!is_accessible) {
+        mod.method("_permute", [](const ExecSpace&, const View&, const PermView&) {
+            jl_errorf("`%s` cannot access views of type `%s`",
+                      jl_typename_str((jl_value_t*) jlcxx::julia_type<ExecSpace>()->super->super),
+                      jl_typename_str((jl_value_t*) jlcxx::julia_type<View>()));
+        });
+    } else {
+        register_permute<ExecSpace, View, PermView>(mod);
+        if constexpr (is_sortable) {
+            register_sort_methods<ExecSpace, View, PermView>(mod);
+        }
+    }
+}
+
+
+JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
+{
+    // Called from 'Kokkos.Views.Impl<number>'
+    jl_module_t* views_module = mod.julia_module()->parent;
+    for (const char* name : { "_sort", "_bin_sort", "_permute" }) {
+        jl_module_import(mod.julia_module(), views_module, jl_symbol(name));
+    }
+
+    if constexpr (Dimension::value != 1) {
+        jl_errorf("Only 1D views can be sorted.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else if constexpr (std::is_void_v<ExecutionSpace>) {
+        jl_errorf("No execution space with the name '" AS_STR(EXEC_SPACE) "'.\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else if constexpr (std::is_void_v<MemorySpace>) {
+        jl_errorf("No memory space with the name '" AS_STR(MEM_SPACE) "'\n"
+                  "Compilation parameters:\n%s", get_params_string());
+    } else {
+        using View = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>;
+        register_sort<ExecutionSpace, View>(mod);
+    }
+
+    mod.method("params_string", get_params_string);
+}
@@ -4,147 +4,79 @@
 #include "layouts.h"
 #include "views.h"
 
-#include <variant>
-
 
 using SubViewDimension = std::integral_constant<int, SUBVIEW_DIM>;
 
 
-struct Colon_t {};  // Mapped to 'Base.Colon'
-struct AbstractUnitRange_t {};  // Mapped to 'Base.AbstractUnitRange{Int64}'
-struct IndexVarargs {};  // Mapped to 'Tuple{Vararg{Union{Base.Colon, Base.AbstractUnitRange{Int64}, Int64}}}'
-
-
-// Range type used by Kokkos for Kokkos::ALL. Maybe a 'Kokkos::pair' instead, idk.
-// See https://kokkos.github.io/kokkos-core-wiki/API/core/view/subview.html
-using Range = std::pair<ptrdiff_t, ptrdiff_t>;
-
-
-void setup_type_mappings()
+/**
+ * Subview of `view` built directly from the bounds of its indexes, with no call to Julia and a single instantiation per
+ * subview type (instead of one `Kokkos::subview` instantiation for each combination of integers and ranges).
+ *
+ * `bounds` has 3 values for each dimension `r` of `view`: the 0-based start index, the step and the length of the
+ * range. A step of 0 is an integer index, and removes the dimension from the subview.
+ * Bounds are checked in `Kokkos.Views._subview_bounds`.
+ *
+ * The subview is built with a `Kokkos::LayoutStride`, where the steps of the ranges are folded into the strides.
+ * Kokkos only assigns a `LayoutStride` view to a `LayoutLeft` or `LayoutRight` view if its strides are exactly
+ * contiguous, therefore 2D subviews which keep the layout of `view` (only possible with unit steps) are built like
+ * `Kokkos::subview` does instead: as a subview of a view padded to the stride of their leading (`LayoutLeft`) or
+ * trailing (`LayoutRight`) dimension, which keeps the padding in their mapping.
+ * No data is copied, and the subview shares the reference count of `view`.
+ */
+template<typename View, typename SubView>
+SubView subview_from_bounds(const View& view, jlcxx::ArrayRef<int64_t> bounds)
 {
-    if (!jlcxx::has_julia_type<IndexVarargs*>()) {
-        auto idx_t = (jl_datatype_t*) jl_eval_string("Tuple{Vararg{Union{Colon, AbstractUnitRange{Int64}, Int64}}}");
-        if (idx_t == nullptr)
-            jl_rethrow();
-        jlcxx::set_julia_type<IndexVarargs*>(idx_t);
-    }
+    using KStridedSubView = typename SubView::template with_layout<Kokkos::LayoutStride>::kokkos_view_t;
 
-    if (!jlcxx::has_julia_type<Colon_t>()) {
-        auto colon_t = (jl_datatype_t*) jl_get_global(jl_base_module, jl_symbol("Colon"));
-        jlcxx::set_julia_type<Colon_t>(colon_t);
+    if (bounds.size() != 3 * View::dim) {
+        jl_errorf("expected %d subview bounds, got %d", int(3 * View::dim), int(bounds.size()));
     }
 
-    if (!jlcxx::has_julia_type<AbstractUnitRange_t>()) {
-        jl_value_t* range_union_all = jl_get_global(jl_base_module, jl_symbol("AbstractUnitRange"));
-        jl_value_t* range_t = jl_apply_type1(range_union_all, (jl_value_t*) jlcxx::julia_base_type<int64_t>());
-        jlcxx::set_julia_type<AbstractUnitRange_t>((jl_datatype_t*) range_t);
+    const typename View::kokkos_view_t& k_view = view;
+    auto* ptr = k_view.data();
+    Kokkos::LayoutStride layout;
+    size_t sub_r = 0;
+    for (size_t r = 0; r < View::dim; r++) {
+        const int64_t start = bounds[3*r], step = bounds[3*r+1], length = bounds[3*r+2];
+        ptr += start * k_view.stride(r);
+        if (step == 0) continue;
+        if (sub_r >= SubView::dim) {
+            jl_errorf("Expected %d integers in indexes list (to obtain a subview of dimension %d)",
+                      int(View::dim - SubView::dim), int(SubView::dim));
+        }
+        layout.dimension[sub_r] = length;
+        layout.stride[sub_r] = step * k_view.stride(r);
+        sub_r++;
     }
-}
-
 
-template<size_t Dim, typename View>
-size_t jl_indexes_to_cpp(jl_value_t* jl_indexes,
-                         std::array<std::variant<int64_t, Range>, Dim>& indexes,
-                         const View& view)
-{
-    // 'jl_indexes' is of type 'Tuple{Vararg{Union{Colon, AbstractUnitRange{Int64}, Int64}}}'
-    jl_value_t* indexes_type = jl_typeof(jl_indexes);
-    int index_count = jl_nparams(indexes_type);
-    if (static_cast<size_t>(index_count) > Dim) {
-        jl_errorf("expected a tuple of %d indexes or slices, got %d", Dim, index_count);
+    if (sub_r != SubView::dim) {
+        jl_errorf("Expected %d integers in indexes list (to obtain a subview of dimension %d), got %d",
+                  int(View::dim - SubView::dim), int(SubView::dim), int(View::dim - sub_r));
     }
 
-    int int_count = 0;
-    int r = -1;
-    for (auto& index : indexes) {
-        r++;
-
-        if (r >= index_count) {
-            // Select the whole dimension by default (Kokkos::ALL)
-            index = Range{0, view.extent(r)};
-            continue;
-        }
-
-        // ':'   => Range(0,v.extent(r))  (equiv to Kokkos::ALL)
-        // 'a:b' => Range(a-1, b)
-        // 'r'   => r-1
-
-        auto* idx_type = (jl_datatype_t*) jl_tparam(indexes_type, r);
-
-        if (idx_type == jlcxx::julia_base_type<int64_t>()) {
-            int64_t val = jl_unbox_int64(jl_get_nth_field(jl_indexes, r));
-            val -= 1;
-            index = val;
-            int_count++;
-            if (!(0 <= val && static_cast<size_t>(val) < view.extent(r))) {
-                jl_bounds_error(jlcxx::box<View>(view), jl_indexes);
-            }
-        } else if (idx_type == jlcxx::julia_type<Colon_t>()) {
-            index = Range{0, view.extent(r)}; // Kokkos::ALL
-        } else if (jl_subtype((jl_value_t*) idx_type, (jl_value_t*) jlcxx::julia_type<AbstractUnitRange_t>())) {
-            jl_value_t* jl_range = jl_get_nth_field(jl_indexes, r);
-
-            jl_value_t* jl_start = jl_call1(jl_get_global(jl_base_module, jl_symbol("first")), jl_range);
-            int64_t start = jl_unbox_int64(jl_start);
-            start -= 1;
-
-            jl_value_t* jl_end = jl_call1(jl_get_global(jl_base_module, jl_symbol("last")), jl_range);
-            int64_t end = jl_unbox_int64(jl_end);
-
-            index = Range{start, end};
-            if (!(0 <= start && start <= end && static_cast<size_t>(end) <= view.extent(r))) {
-                jl_bounds_error(jlcxx::box<View>(view), jl_indexes);
-            }
-        } else {
-            jl_errorf("Expected a value of type Union{Colon, AbstractUnitRange{Int64}, Int64}, got: %s",
-                      jl_typename_str((jl_value_t*) idx_type));
-        }
+    // Views constructed from a pointer are unmanaged: the mapping is then combined with the tracker of the parent view
+    // (like `Kokkos::subview` does), in order to keep its memory alive as long as the subview is.
+    using KSubView = typename SubView::kokkos_view_t;
+    using Layout = typename SubView::layout;
+    if constexpr (SubView::dim == 2 && std::is_same_v<Layout, Kokkos::LayoutLeft>) {
+        const KSubView padded(ptr, layout.stride[1], layout.dimension[1]);
+        const KSubView unmanaged_sub_view = Kokkos::subview(padded,
+            Kokkos::pair<size_t, size_t>(0, layout.dimension[0]), Kokkos::ALL);
+        return SubView(KSubView(k_view.impl_track(), unmanaged_sub_view.impl_map()));
+    } else if constexpr (SubView::dim == 2 && std::is_same_v<Layout, Kokkos::LayoutRight>) {
+        const KSubView padded(ptr, layout.dimension[0], layout.stride[0]);
+        const KSubView unmanaged_sub_view = Kokkos::subview(padded,
+            Kokkos::ALL, Kokkos::pair<size_t, size_t>(0, layout.dimension[1]));
+        return SubView(KSubView(k_view.impl_track(), unmanaged_sub_view.impl_map()));
+    } else {
+        // 1D subviews keeping the layout are always contiguous
+        const KStridedSubView unmanaged_sub_view(ptr, layout);
+        return SubView(KSubView(KStridedSubView(k_view.impl_track(), unmanaged_sub_view.impl_map())));
     }
-
-    return int_count;
 }
 
 
-/**
- * Instantiates all possible combinations of `Kokkos::subview()` which, when applied to a `View`, returns a `SubView`.
- * `Indexes` are the list of index types given to `Kokkos::subview`.
- *
- * `Indexes` are `std::variant<int64_t, Range>`. `int64_t` reduces the dimension of the resulting view, while `Range`
- * does not.
- */
-template<typename View, typename SubView, typename... Indexes>
-SubView do_subview(const View& view, const std::tuple<Indexes...>& indexes_tuple)
-{
-    return std::apply([&](const Indexes&... indexes) {
-        // 'std::visit' will automatically instantiate all combinations of the possible values of the variants.
-        // Therefore, we must filter them by checking if the variant combination matches with the expected subview
-        // dimension.
-        return std::visit([&](auto&&... idx) {
-            constexpr auto int_count = count_same<int64_t, std::decay_t<decltype(idx)>...>();
-            if constexpr ((View::dim - int_count) == SubView::dim) {
-                if constexpr (std::is_same_v<typename View::layout, typename SubView::layout> &&
-                        !std::is_same_v<typename SubView::kokkos_view_t, Kokkos::Subview<View, std::decay_t<decltype(idx)>...>>) {
-                    // Kokkos::subview would have returned an incompatible subview type
-                    jl_errorf("Internal subview call error. Expected a Kokkos::Subview type of '%s', got '%s'",
-                              typeid(typename SubView::kokkos_view_t).name(),
-                              typeid(Kokkos::Subview<View, std::decay_t<decltype(idx)>...>).name());
-                    // Dummy return value, an empty view with a defaulted layout. This code is unreachable.
-                    return SubView("ERROR", typename SubView::layout{});
-                } else {
-                    return SubView(Kokkos::subview(view, idx...));
-                }
-            } else {
-                jl_errorf("Internal subview call error. Expected %d integers in indexes list, got %d",
-                          View::dim - SubView::dim, int_count);
-                // Dummy return value, an empty view with a defaulted layout. This code is unreachable.
-                return SubView("ERROR", typename SubView::layout{});
-            }
-        }, indexes...);
-    }, indexes_tuple);
-}
-
-
-template<typename View, typename SubView, typename Layout>
+template<typename View, typename SubView>
 void register_subviews_for_view_and_layout(jlcxx::Module& mod)
 {
     if constexpr (!std::is_same_v<typename View::layout, Kokkos::LayoutStride>) {
@@ -152,43 +84,23 @@ void register_subviews_for_view_and_layout(jlcxx::Module& mod)
         // value is different and therefore requires a separate method.
         using SubViewStrided = typename SubView::template with_layout<Kokkos::LayoutStride>;
 
-        // method signature: (View{T, D, L, M}, Tuple{Vararg{Union{Colon, AbstractUnitRange, Int64}}}, Val{SubDim}, LayoutStride)
-        mod.method("subview",
-        [](const View& v, IndexVarargs* indexes,
+        // method signature: (View{T, D, L, M}, Vector{Int64}, Val{SubDim}, LayoutStride)
+        mod.method("_subview",
+        [](const View& v, jlcxx::ArrayRef<int64_t> bounds,
                 jlcxx::SingletonType<jlcxx::Val<int64_t, SubView::dim>>,
                 jlcxx::SingletonType<Kokkos::LayoutStride>)
         {
-            auto* jl_indexes = reinterpret_cast<jl_value_t*>(indexes);
-
-            std::array<std::variant<int64_t, Range>, View::dim> view_indexes;
-            size_t int_count = jl_indexes_to_cpp(jl_indexes, view_indexes, v);
-
-            if (View::dim - int_count != SubViewStrided::dim) {
-                jl_errorf("Expected %d integers in indexes list (to obtain a subview of dimension %d), got %d",
-                          View::dim - SubViewStrided::dim, SubViewStrided::dim, int_count);
-            }
-
-            return do_subview<View, SubViewStrided>(v, std::tuple_cat(view_indexes));
+            return subview_from_bounds<View, SubViewStrided>(v, bounds);
         });
     }
 
-    // method signature: (View{T, D, L, M}, Tuple{Vararg{Union{Colon, AbstractUnitRange, Int64}}}, Val{SubDim}, Layout)
-    mod.method("subview",
-    [](const View& v, IndexVarargs* indexes,
+    // method signature: (View{T, D, L, M}, Vector{Int64}, Val{SubDim}, Layout)
+    mod.method("_subview",
+    [](const View& v, jlcxx::ArrayRef<int64_t> bounds,
             jlcxx::SingletonType<jlcxx::Val<int64_t, SubView::dim>>,
             jlcxx::SingletonType<typename View::layout>)
     {
-        auto* jl_indexes = reinterpret_cast<jl_value_t*>(indexes);
-
-        std::array<std::variant<int64_t, Range>, View::dim> view_indexes;
-        size_t int_count = jl_indexes_to_cpp(jl_indexes, view_indexes, v);
-
-        if (View::dim - int_count != SubView::dim) {
-            jl_errorf("Expected %d integers in indexes list (to obtain a subview of dimension %d), got %d",
-                      View::dim - SubView::dim, SubView::dim, int_count);
-        }
-
-        return do_subview<View, SubView>(v, std::tuple_cat(view_indexes));
+        return subview_from_bounds<View, SubView>(v, bounds);
     });
 }
 
@@ -203,15 +115,16 @@ void register_all_subviews(jlcxx::Module& mod)
         jl_errorf("No memory space with the name '" AS_STR(MEM_SPACE) "'.\n"
                   "Compilation parameters:\n%s", get_params_string());
     } else {
-        using View = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace>;
-        using SubView = ViewWrap<VIEW_TYPE, SubViewDimension, Layout, MemorySpace>;
+        // Memory traits are kept by `Kokkos::subview`
+        using View = ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>;
+        using SubView = ViewWrap<VIEW_TYPE, SubViewDimension, Layout, MemorySpace, MemTraits>;
 
         if (!jlcxx::has_julia_type<SubView>()) {
             jl_errorf("Missing view type for complete `Kokkos.subview` coverage: %dD of c++ type %s",
                       SubViewDimension::value, typeid(SubView).name());
         }
 
-        register_subviews_for_view_and_layout<View, SubView, Layout>(mod);
+        register_subviews_for_view_and_layout<View, SubView>(mod);
     }
 }
 
@@ -220,9 +133,8 @@ JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
 {
     // Called from 'Kokkos.Views.Impl<number>'
     jl_module_t* views_module = mod.julia_module()->parent;
-    jl_module_import(mod.julia_module(), views_module, jl_symbol("subview"));
+    jl_module_import(mod.julia_module(), views_module, jl_symbol("_subview"));
 
-    setup_type_mappings();
     register_all_subviews(mod);
     mod.method("params_string", get_params_string);
 }
@@ -0,0 +1,60 @@
+#ifndef KOKKOS_WRAPPER_VIEW_INDEXING_H
+#define KOKKOS_WRAPPER_VIEW_INDEXING_H
+
+#include "Kokkos_Core.hpp"
+
+
+/**
+ * Indexing of views of any dimension from a linear index, shared by the kernels of the sub-libraries iterating over
+ * all elements of a view with a `Kokkos::RangePolicy`.
+ */
+
+
+using Indices = Kokkos::Array<int64_t, 8>;
+
+
+/**
+ * Converts a linear index into the indices of a `D`-dimensional view of extents `dims`, iterating along the dimensions
+ * in the memory order of `Layout` in order to have contiguous accesses in most cases.
+ */
+template<typename Layout, size_t D>
+KOKKOS_INLINE_FUNCTION Indices linear_to_indices(int64_t i, const Indices& dims)
+{
+    Indices idx{};  // Indices after the view's rank must stay at 0
+    if constexpr (std::is_same_v<Layout, Kokkos::LayoutRight>) {
+        for (int d = int(D) - 1; d >= 0; d--) {
+            idx[d] = i % dims[d];
+            i /= dims[d];
+        }
+    } else {
+        for (size_t d = 0; d < D; d++) {
+            idx[d] = i % dims[d];
+            i /= dims[d];
+        }
+    }
+    return idx;
+}
+
+
+template<typename KokkosView>
+KOKKOS_INLINE_FUNCTION auto view_at(const KokkosView& view, const Indices& idx)
+{
+    // Returns a copy of the value, not a reference, since the view might have the `Atomic` memory trait
+    return typename KokkosView::non_const_value_type(
+            view.access(idx[0], idx[1], idx[2], idx[3], idx[4], idx[5], idx[6], idx[7]));
+}
+
+
+template<typename View>
+Indices view_extents(const View& view, int64_t& total)
+{
+    Indices dims{};
+    total = 1;
+    for (size_t d = 0; d < View::dim; d++) {
+        dims[d] = view.extent_int(d);
+        total *= dims[d];
+    }
+    return dims;
+}
+
+#endif //KOKKOS_WRAPPER_VIEW_INDEXING_H
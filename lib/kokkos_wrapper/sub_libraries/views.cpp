@@ -121,11 +121,34 @@ Layout unbox_layout_arg(jl_value_t* boxed_layout, const std::array<size_t, KOKKO
 }
 
 
-template<typename Dimension, typename Layout, typename MemSpace>
+/**
+ * Returns the Julia type `Kokkos.MemoryTraits{Flags}` matching `MemTraits`.
+ */
+template<typename MemTraits>
+jl_value_t* build_memory_traits_type(jl_module_t* views_module)
+{
+    jl_value_t* traits_t = jl_get_global(views_module, jl_symbol("MemoryTraits"));
+    if (traits_t == nullptr) {
+        throw std::runtime_error("Type 'MemoryTraits' not found in the Kokkos.Views module");
+    }
+
+    jl_value_t* flags = jl_box_int64(memory_traits_flags<MemTraits>::value);
+    JL_GC_PUSH1(&flags);
+    jl_value_t* memory_traits_type = jl_apply_type1(traits_t, flags);
+    JL_GC_POP();
+
+    return memory_traits_type;
+}
+
+
+template<typename Dimension, typename Layout, typename MemSpace, typename MemTraits>
 struct RegisterUtils
 {
     static constexpr size_t D = Dimension::value;
 
+    template<typename T>
+    using view_t = ViewWrap<T, Dimension, Layout, MemSpace, MemTraits>;
+
 
     static std::string build_view_type_name()
     {
@@ -141,6 +164,9 @@ struct RegisterUtils
             static_assert(std::is_same_v<Layout, void>, "Unknown layout type");
         }
         str << MemSpace::name();
+        if constexpr (memory_traits_flags<MemTraits>::value != 0) {
+            str << "_MT" << memory_traits_flags<MemTraits>::value;
+        }
         return str.str();
     }
 
@@ -148,10 +174,11 @@ struct RegisterUtils
     static jl_value_t* build_abstract_array_type(jl_module_t* views_module)
     {
         // Since we call `mod.add_type` by applying only the data type of the array, we need a UnionAll with the
-        // dimension already specified. The Julia equivalent would be `Kokkos.View{T, D, Layout, MemSpace} where T`.
+        // dimension already specified. The Julia equivalent would be
+        // `Kokkos.View{T, D, Layout, MemSpace, MemTraits} where T`.
 
         jl_value_t** stack;
-        JL_GC_PUSHARGS(stack, 6);
+        JL_GC_PUSHARGS(stack, 7);
 
         // `T_var = TypeVar(:T)`
         jl_tvar_t* T_var = jl_new_typevar(jl_symbol("T"), jl_bottom_type, (jl_value_t*) jl_any_type);
@@ -160,19 +187,20 @@ struct RegisterUtils
         stack[1] = jl_box_int64(D);
         stack[2] = (jl_value_t*) jlcxx::julia_type<Layout>();
         stack[3] = (jl_value_t*) jlcxx::julia_type<MemSpace>();
+        stack[4] = build_memory_traits_type<MemTraits>(views_module);
 
         // `Kokkos.View`
         jl_value_t* view_t = jl_get_global(views_module, jl_symbol("View"));
-        stack[4] = view_t;
+        stack[5] = view_t;
         if (view_t == nullptr) {
             throw std::runtime_error("Type 'View' not found in the Kokkos.Views module");
         }
 
-        // `Kokkos.View{T_var, dim, layout_type, space_type}`
-        jl_value_t* view_data_type = jl_apply_type(view_t, stack, 4);
-        stack[5] = view_data_type;
+        // `Kokkos.View{T_var, dim, layout_type, space_type, traits_type}`
+        jl_value_t* view_data_type = jl_apply_type(view_t, stack, 5);
+        stack[6] = view_data_type;
 
-        // `Kokkos.View{T_var, dim, layout_type, space_type} where T_var`
+        // `Kokkos.View{T_var, dim, layout_type, space_type, traits_type} where T_var`
         jl_value_t* view_union_all = jl_type_unionall(T_var, view_data_type);
 
         JL_GC_POP();
@@ -185,17 +213,18 @@ struct RegisterUtils
     static jl_datatype_t* build_array_complete_type(jl_module_t* views_module)
     {
         jl_value_t** stack;
-        JL_GC_PUSHARGS(stack, 5);
+        JL_GC_PUSHARGS(stack, 6);
 
         stack[0] = (jl_value_t*) jlcxx::julia_type<T>();
         stack[1] = jl_box_int64(D);
         stack[2] = (jl_value_t*) jlcxx::julia_type<Layout>();
         stack[3] = (jl_value_t*) jlcxx::julia_type<SpaceInfo<MemSpace>>();
+        stack[4] = build_memory_traits_type<MemTraits>(views_module);
 
         jl_value_t* view_t = jl_get_global(views_module, jl_symbol("View"));
-        stack[4] = view_t;
+        stack[5] = view_t;
 
-        jl_value_t* array_ctor_t = jl_apply_type(view_t, stack, 4);
+        jl_value_t* array_ctor_t = jl_apply_type(view_t, stack, 5);
 
         JL_GC_POP();
 
@@ -221,10 +250,10 @@ struct RegisterUtils
      *  - an instance of one of the `Layout` sub-types, only `LayoutStride` instances are useful in this case
      */
     template<typename T, typename... Dims>
-    static ViewWrap<T, Dimension, Layout, MemSpace> create_view(const std::tuple<Dims...>& dims,
-                                                                jl_value_t* boxed_memory_space,
-                                                                jl_value_t* boxed_layout,
-                                                                const char* label, bool init, bool pad)
+    static view_t<T> create_view(const std::tuple<Dims...>& dims,
+                                 jl_value_t* boxed_memory_space,
+                                 jl_value_t* boxed_layout,
+                                 const char* label, bool init, bool pad)
     {
         static_assert(D == sizeof...(Dims));
 
@@ -244,26 +273,25 @@ struct RegisterUtils
         if constexpr (allow_pad) if (pad) {
             if (init) {
                 auto ctor_prop = Kokkos::view_alloc(label_str, mem_space, Kokkos::AllowPadding);
-                return ViewWrap<T, Dimension, Layout, MemSpace>(ctor_prop, layout);
+                return view_t<T>(ctor_prop, layout);
             } else {
                 auto ctor_prop = Kokkos::view_alloc(label_str, mem_space, Kokkos::WithoutInitializing, Kokkos::AllowPadding);
-                return ViewWrap<T, Dimension, Layout, MemSpace>(ctor_prop, layout);
+                return view_t<T>(ctor_prop, layout);
             }
         }
 
         if (init) {
             auto ctor_prop = Kokkos::view_alloc(label_str, mem_space);
-            return ViewWrap<T, Dimension, Layout, MemSpace>(ctor_prop, layout);
+            return view_t<T>(ctor_prop, layout);
         } else {
             auto ctor_prop = Kokkos::view_alloc(label_str, mem_space, Kokkos::WithoutInitializing);
-            return ViewWrap<T, Dimension, Layout, MemSpace>(ctor_prop, layout);
+            return view_t<T>(ctor_prop, layout);
         }
     }
 
 
     template<typename T, typename... Dims>
-    static ViewWrap<T, Dimension, Layout, MemSpace> view_wrap(const std::tuple<Dims...>& dims,
-                                                              jl_value_t* boxed_layout, T* data_ptr)
+    static view_t<T> view_wrap(const std::tuple<Dims...>& dims, jl_value_t* boxed_layout, T* data_ptr)
     {
         static_assert(D == sizeof...(Dims));
 
@@ -277,7 +305,7 @@ struct RegisterUtils
         using ctor_prop_t = Kokkos::Impl::ViewCtorProp<typename Kokkos::Impl::ViewCtorProp<void, T*>::type>;
         auto ctor_prop = ctor_prop_t(data_ptr);
 #endif // KOKKOS_VERSION_CMP(>=, 4, 0, 0)
-        return ViewWrap<T, Dimension, Layout, MemSpace>(ctor_prop, layout);
+        return view_t<T>(ctor_prop, layout);
     }
 
 
@@ -303,8 +331,17 @@ struct RegisterUtils
     static void register_access_operator(Wrapped wrapped, TList<Indices...>)
     {
         using WrappedT = typename decltype(wrapped)::type;
-        // Add a method for integer indexing: `_get_ptr(i::Idx)` in 1D, `_get_ptr(i::Idx, j::Idx)` in 2D, etc
-        wrapped.method("_get_ptr", &WrappedT::template operator()<Indices...>);
+        if constexpr (std::is_reference_v<typename WrappedT::reference_type>) {
+            // Add a method for integer indexing: `_get_ptr(i::Idx)` in 1D, `_get_ptr(i::Idx, j::Idx)` in 2D, etc
+            wrapped.method("_get_ptr", &WrappedT::template operator()<Indices...>);
+        } else {
+            // Views with the `Atomic` memory trait do not return references: access the elements through an
+            // unmanaged view with no memory traits instead.
+            using PlainView = typename WrappedT::template with_mem_traits<Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+            wrapped.method("_get_ptr", [](const WrappedT& view, Indices... i) -> typename WrappedT::type& {
+                return PlainView(view.data(), view.layout())(i...);
+            });
+        }
     }
 
 
@@ -327,6 +364,78 @@ struct RegisterUtils
     }
 
 
+    /**
+     * Copies the region of `view` starting at the (0-based) indices `start` and of size `count` to the column-major
+     * array `array` of size `count` if `ToView` is false, or from `array` to `view` if `ToView` is true.
+     *
+     * Iterations are ordered like `array`, while `view` is accessed through `View::access`, which respects its layout
+     * and strides.
+     */
+    template<bool ToView, typename WrappedT, typename T>
+    static void copy_region(const WrappedT& view,
+                            const std::array<size_t, KOKKOS_MAX_DIMENSIONS>& start,
+                            const std::array<size_t, KOKKOS_MAX_DIMENSIONS>& count,
+                            T* array)
+    {
+        size_t total = 1;
+        for (size_t d = 0; d < D; d++) {
+            total *= count[d];
+        }
+        if (total == 0) return;
+
+        Kokkos::parallel_for("Kokkos.jl::copy_region",
+                             Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, total),
+        [=](const size_t i) {
+            // Indices after the view's rank must stay at 0
+            std::array<size_t, KOKKOS_MAX_DIMENSIONS> idx{};
+            size_t rem = i;
+            for (size_t d = 0; d < D; d++) {
+                idx[d] = start[d] + rem % count[d];
+                rem /= count[d];
+            }
+
+            // Not a reference for views with the `Atomic` memory trait
+            auto&& elem = view.access(idx[0], idx[1], idx[2], idx[3], idx[4], idx[5], idx[6], idx[7]);
+            if constexpr (ToView) {
+                elem = array[i];
+            } else {
+                array[i] = elem;
+            }
+        });
+
+        Kokkos::DefaultHostExecutionSpace().fence("Kokkos.jl::copy_region");
+    }
+
+
+    template<typename Wrapped>
+    static void register_region_copy(Wrapped wrapped)
+    {
+        using WrappedT = typename decltype(wrapped)::type;
+        using T = typename WrappedT::type;
+        using DimsTuple = decltype(std::tuple_cat(std::array<int64_t, D>()));
+
+        if constexpr (Kokkos::SpaceAccessibility<Kokkos::DefaultHostExecutionSpace, MemSpace>::accessible) {
+            wrapped.method("_copy_to_array",
+            [](const WrappedT& view, const DimsTuple& start, const DimsTuple& count, T* dest)
+            {
+                copy_region<false>(view, unpack_dims(start), unpack_dims(count), dest);
+            });
+
+            wrapped.method("_copy_from_array",
+            [](const WrappedT& view, const DimsTuple& start, const DimsTuple& count, T* src)
+            {
+                copy_region<true>(view, unpack_dims(start), unpack_dims(count), src);
+            });
+        } else {
+            wrapped.method("_copy_to_array",
+            [](const WrappedT& view, const DimsTuple&, const DimsTuple&, T*) { throw_inaccessible_error(view); });
+
+            wrapped.method("_copy_from_array",
+            [](const WrappedT& view, const DimsTuple&, const DimsTuple&, T*) { throw_inaccessible_error(view); });
+        }
+    }
+
+
     template<typename Wrapped, typename complete_type>
     static void register_constructor(jlcxx::Module& mod, jl_module_t* views_module) {
         using type = typename Wrapped::type;
@@ -336,13 +445,16 @@ struct RegisterUtils
 
         using DimsTuple = decltype(std::tuple_cat(std::array<int64_t, D>()));
 
-        mod.method("alloc_view",
-        [](jlcxx::SingletonType<complete_type>, const DimsTuple& dims,
-           jl_value_t* boxed_memory_space, jl_value_t* boxed_layout,
-           const char* label, bool init, bool pad)
-        {
-            return create_view<type>(dims, boxed_memory_space, boxed_layout, label, init, pad);
-        });
+        if constexpr (Wrapped::traits::is_managed) {
+            // Views with the `Unmanaged` memory trait cannot be allocated
+            mod.method("alloc_view",
+            [](jlcxx::SingletonType<complete_type>, const DimsTuple& dims,
+               jl_value_t* boxed_memory_space, jl_value_t* boxed_layout,
+               const char* label, bool init, bool pad)
+            {
+                return create_view<type>(dims, boxed_memory_space, boxed_layout, label, init, pad);
+            });
+        }
 
         mod.method("view_wrap",
         [](jlcxx::SingletonType<complete_type>, const DimsTuple& dims, jl_value_t* boxed_layout, type* data_ptr)
@@ -354,9 +466,9 @@ struct RegisterUtils
 
 
 template<>
-struct jlcxx::Finalizer<ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace>, jlcxx::SpecializedFinalizer>
+struct jlcxx::Finalizer<ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>, jlcxx::SpecializedFinalizer>
 {
-    static void finalize(ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace>* view)
+    static void finalize(ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>* view)
     {
         if (!Kokkos::is_finalized()) {
             delete view;
@@ -371,10 +483,10 @@ struct jlcxx::Finalizer<ViewWrap<VIEW_TYPE, Dimension, Layout, MemorySpace>, jlc
 };
 
 
-template<typename ViewType, typename ViewDim, typename ViewLayout, typename ViewMemSpace>
+template<typename ViewType, typename ViewDim, typename ViewLayout, typename ViewMemSpace, typename ViewMemTraits>
 void register_all_view_combinations(jlcxx::Module& mod, jl_module_t* views_module)
 {
-    using RegUtils = RegisterUtils<ViewDim, ViewLayout, ViewMemSpace>;
+    using RegUtils = RegisterUtils<ViewDim, ViewLayout, ViewMemSpace, ViewMemTraits>;
 
     std::string name = RegUtils::build_view_type_name();
     jl_value_t* view_type = RegUtils::build_abstract_array_type(views_module);
@@ -390,18 +502,20 @@ void register_all_view_combinations(jlcxx::Module& mod, jl_module_t* views_modul
                 jlcxx::ParameterList<ViewType>,
                 jlcxx::ParameterList<ViewDim>,
                 jlcxx::ParameterList<ViewLayout>,
-                jlcxx::ParameterList<ViewMemSpace>
+                jlcxx::ParameterList<ViewMemSpace>,
+                jlcxx::ParameterList<ViewMemTraits>
     >([&](auto wrapped) {
         // `Wrapped_t` is mapped to the `View_<dim>D_<layout>_<mem space>` type: aka the 'impl' type.
         using Wrapped_t = typename decltype(wrapped)::type;
 
-        // `complete_type` is mapped to the `View{T, D, L, M}` type: aka the 'main' type. It is an abstract type on
+        // `complete_type` is mapped to the `View{T, D, L, M, MT}` type: aka the 'main' type. It is an abstract type on
         // the Julia side.
         // On the C++ side, it is mapped to `TList<Wrapped_t>`, to make it easy to build and work with.
         using complete_type = TList<Wrapped_t>;
 
         RegUtils::template register_constructor<Wrapped_t, complete_type>(mod, views_module);
         RegUtils::register_access_operator(wrapped);
+        RegUtils::register_region_copy(wrapped);
 
         wrapped.method("impl_view_type", [](jlcxx::SingletonType<complete_type>) {
             return jlcxx::julia_type<Wrapped_t>();
@@ -419,12 +533,21 @@ void register_all_view_combinations(jlcxx::Module& mod, jl_module_t* views_modul
             }
         });
 
+        wrapped.method("_get_metadata_offset", [](jlcxx::SingletonType<complete_type>) {
+            return static_cast<int64_t>(Wrapped_t::metadata_offset());
+        });
+
+        wrapped.method("update_metadata!", [](Wrapped_t& view) { view.update_metadata(); });
+
         wrapped.method("view_data", &Wrapped_t::data);
         wrapped.method("label", &Wrapped_t::label);
         wrapped.method("memory_span", [](const Wrapped_t& view) { return view.impl_map().memory_span(); });
         wrapped.method("span_is_contiguous", &Wrapped_t::span_is_contiguous);
         wrapped.method("_get_dims", [](const Wrapped_t& view) { return std::tuple_cat(view.get_dims()); });
         wrapped.method("_get_strides", [](const Wrapped_t& view) { return std::tuple_cat(view.get_strides()); });
+        wrapped.method("_untracked_copy", [](const Wrapped_t& view) {
+            return Wrapped_t(static_cast<const typename Wrapped_t::kokkos_view_t&>(view));
+        });
         wrapped.method("get_tracker", [](const Wrapped_t& view) {
             if (view.impl_track().has_record()) {
                 return reinterpret_cast<void*>(view.impl_track().template get_record<void>()->data());
@@ -449,9 +572,14 @@ void import_all_views_methods(jl_module_t* impl_module, jl_module_t* views_modul
         "span_is_contiguous",
         "label",
         "_get_ptr",
+        "_copy_to_array",
+        "_copy_from_array",
         "_get_dims",
         "_get_strides",
         "get_tracker",
+        "_untracked_copy",
+        "_get_metadata_offset",
+        "update_metadata!",
         "impl_view_type",
         "host_mirror_space",
         "cxx_type_name"
@@ -473,7 +601,7 @@ JLCXX_MODULE define_kokkos_module(jlcxx::Module& mod)
         jl_errorf("No memory space with the name '" AS_STR(MEM_SPACE) "'\n"
                   "Compilation parameters:\n%s", get_params_string());
     } else {
-        register_all_view_combinations<VIEW_TYPE, Dimension, Layout, MemorySpace>(mod, views_module);
+        register_all_view_combinations<VIEW_TYPE, Dimension, Layout, MemorySpace, MemTraits>(mod, views_module);
     }
 
     mod.method("params_string", get_params_string);
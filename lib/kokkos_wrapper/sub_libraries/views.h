@@ -9,6 +9,18 @@
 
 
 using Dimension = std::integral_constant<int, VIEW_DIMENSION>;
+using MemTraits = Kokkos::MemoryTraits<VIEW_MEM_TRAITS>;
+using DestMemTraits = Kokkos::MemoryTraits<DEST_MEM_TRAITS>;
+
+
+/**
+ * The flags of a `Kokkos::MemoryTraits` type: `memory_traits_flags<Kokkos::MemoryTraits<3>>::value == 3`
+ */
+template<typename>
+struct memory_traits_flags;
+
+template<unsigned Flags>
+struct memory_traits_flags<Kokkos::MemoryTraits<Flags>> : std::integral_constant<unsigned, Flags> {};
 
 
 /**
@@ -21,6 +33,49 @@ template<typename T>
 struct add_pointers<T, 0> { using type = T; };
 
 
+/**
+ * Metadata of a view, cached when the view is constructed.
+ *
+ * It is placed in `ViewWrap` after the `Kokkos::View`, which must stay at the start of the object for `Ref{View}`
+ * arguments of `ccall`s to be valid `Kokkos::View&`, and after some padding: it is always `VIEW_METADATA_OFFSET` bytes
+ * after the start of the object. Julia reads it directly from the pointer to the object, without any call to the
+ * library. Its layout must match the one of `Kokkos.Views.ViewMetadata`.
+ *
+ * The metadata is not updated when the view is modified through a `Kokkos::View&` (e.g. assigned from a C++ function):
+ * `ViewWrap::update_metadata()` must then be called.
+ */
+template<typename T, size_t D>
+struct ViewMetadata
+{
+    T* cached_data = nullptr;
+    bool cached_host_accessible = false;
+    std::array<int64_t, D> cached_dims{};
+    std::array<int64_t, D> cached_strides{};
+};
+
+
+/**
+ * Offset of the `ViewMetadata` in all `ViewWrap` objects, in bytes. Must match `Kokkos.Views.VIEW_METADATA_OFFSET`.
+ * Large enough for any `Kokkos::View` (a `LayoutStride` view of 8 dimensions takes 144 bytes on most backends).
+ */
+constexpr size_t VIEW_METADATA_OFFSET = 256;
+
+
+/**
+ * Padding between the `Kokkos::View` and the `ViewMetadata` in a `ViewWrap`, placing the metadata at
+ * `VIEW_METADATA_OFFSET`.
+ */
+template<size_t ViewSize>
+struct ViewMetadataPadding
+{
+    static_assert(ViewSize <= VIEW_METADATA_OFFSET, "`VIEW_METADATA_OFFSET` is too small for this `Kokkos::View`");
+    std::array<char, VIEW_METADATA_OFFSET - ViewSize> padding;
+};
+
+template<>
+struct ViewMetadataPadding<VIEW_METADATA_OFFSET> {};
+
+
 /**
  * Basic wrapper around a `Kokkos::View`, mostly providing convenience functionalities over dimensions and the data type
  * of the view.
@@ -36,11 +91,14 @@ template<typename T, typename DimCst, typename LayoutType, typename MemSpace,
          typename T_Ptr = typename add_pointers<T, DimCst::value>::type,
          typename Device = typename MemSpace::device_type,
          typename KokkosViewT = typename Kokkos::View<T_Ptr, LayoutType, Device, MemTraits>>
-struct ViewWrap : public KokkosViewT
+struct ViewWrap : public KokkosViewT,
+                  private ViewMetadataPadding<sizeof(KokkosViewT)>,
+                  public ViewMetadata<T, DimCst::value>
 {
     using type = T;
     using layout = LayoutType;
     using mem_space = MemSpace;
+    using mem_traits = MemTraits;
 
     using kokkos_view_t = KokkosViewT;
 
@@ -48,35 +106,47 @@ struct ViewWrap : public KokkosViewT
     using with_layout = ViewWrap<T, DimCst, OtherLayout, MemSpace, MemTraits>;
 
     template<typename OtherMemSpace>
-    using with_mem_space = ViewWrap<T, DimCst, Layout, OtherMemSpace, MemTraits>;
+    using with_mem_space = ViewWrap<T, DimCst, LayoutType, OtherMemSpace, MemTraits>;
+
+    template<typename OtherMemTraits>
+    using with_mem_traits = ViewWrap<T, DimCst, LayoutType, MemSpace, OtherMemTraits>;
+
+    // Memory traits are not carried over to mirrors, like for `Kokkos::View::HostMirror`
+    template<typename OtherMemSpace>
+    using mirror_view_t = ViewWrap<T, DimCst, LayoutType, OtherMemSpace>;
 
     static constexpr size_t dim = DimCst::value;
 
-#ifdef __INTEL_COMPILER
+    // Inheriting the constructors of `Kokkos::View` would leave the metadata uninitialized
     template<typename... Args>
-    ViewWrap(Args&&... args) : KokkosViewT(std::forward<Args>(args)...) {}
-#else
-    // Should be 'using typename KokkosViewT::View;' but compiler incompatibilities make this impossible
-    using Kokkos::View<T_Ptr, LayoutType, Device, MemTraits>::View;
-#endif // __INTEL_COMPILER
+    explicit ViewWrap(Args&&... args) : KokkosViewT(std::forward<Args>(args)...) { update_metadata(); }
 
-    explicit ViewWrap(const KokkosViewT& other) : KokkosViewT(other) {};
-    explicit ViewWrap(KokkosViewT&& other) : KokkosViewT(std::move(other)) {};
+    explicit ViewWrap(const KokkosViewT& other) : KokkosViewT(other) { update_metadata(); };
+    explicit ViewWrap(KokkosViewT&& other) : KokkosViewT(std::move(other)) { update_metadata(); };
 
-    [[nodiscard]] std::array<int64_t, dim> get_dims() const {
-        std::array<int64_t, dim> dims{};
-        for (size_t i = 0; i < dim; i++) {
-            dims.at(i) = this->extent_int(i);
-        }
-        return dims;
+    [[nodiscard]] const std::array<int64_t, dim>& get_dims() const { return this->cached_dims; }
+
+    [[nodiscard]] const std::array<int64_t, dim>& get_strides() const { return this->cached_strides; }
+
+    /**
+     * Offset of the `ViewMetadata` base in a `ViewWrap` object, in bytes. Always `VIEW_METADATA_OFFSET`.
+     */
+    static size_t metadata_offset()
+    {
+        // Any suitably aligned non-null address works, as long as it is not dereferenced
+        const auto* wrap = reinterpret_cast<const ViewWrap*>(alignof(ViewWrap));
+        const auto* metadata = static_cast<const ViewMetadata<T, DimCst::value>*>(wrap);
+        return reinterpret_cast<uintptr_t>(metadata) - reinterpret_cast<uintptr_t>(wrap);
     }
 
-    [[nodiscard]] std::array<int64_t, dim> get_strides() const {
-        std::array<int64_t, dim> strides{};
+    void update_metadata()
+    {
+        this->cached_data = this->data();
+        this->cached_host_accessible = Kokkos::SpaceAccessibility<Kokkos::DefaultHostExecutionSpace, MemSpace>::accessible;
         for (size_t i = 0; i < dim; i++) {
-            strides.at(i) = this->stride(i);
+            this->cached_dims.at(i) = this->extent_int(i);
+            this->cached_strides.at(i) = this->stride(i);
         }
-        return strides;
     }
 };
 
@@ -16,7 +16,7 @@ export KokkosProject, CMakeKokkosProject, CLibrary
 export configure, compile, clean, options, option!
 export is_valid, handle, load_lib, unload_lib, is_lib_loaded, get_symbol
 export memory_space, execution_space, array_layout, enabled, main_space_type
-export accessible, label, view_wrap
+export accessible, label, view_wrap, memory_traits
 
 
 __get_scratch_build_dir() = joinpath(@get_scratch!("kokkos-build"), string(hash(Base.active_project()), base=16))
@@ -31,6 +31,9 @@ const __DEFAULT_KOKKOS_LIB_OPTIONS   = []
 const __DEFAULT_KOKKOS_BACKENDS      = ["Serial", "OpenMP"]
 const __DEFAULT_KOKKOS_BUILD_TYPE    = "Release"
 const __DEFAULT_KOKKOS_BUILD_DIR     = __get_scratch_build_dir()
+const __DEFAULT_KOKKOS_LIBS_CACHE_DIR  = nothing  # In the build dir of the wrapper library
+const __DEFAULT_KOKKOS_LIBS_CACHE_SIZE = 10 * 2^30  # 10 GiB
+const __DEFAULT_KOKKOS_PREBUILT_VIEWS  = nothing  # No views are compiled with the wrapper library
 
 LOCAL_KOKKOS_VERSION_STR = @load_preference("kokkos_version", __DEFAULT_KOKKOS_VERSION_STR)
 LOCAL_KOKKOS_DIR = @get_scratch!("kokkos-" * LOCAL_KOKKOS_VERSION_STR)
@@ -41,6 +44,9 @@ KOKKOS_LIB_OPTIONS   = @load_preference("kokkos_options", __DEFAULT_KOKKOS_LIB_O
 KOKKOS_BACKENDS      = @load_preference("backends",       __DEFAULT_KOKKOS_BACKENDS)
 KOKKOS_BUILD_TYPE    = @load_preference("build_type",     __DEFAULT_KOKKOS_BUILD_TYPE)
 KOKKOS_BUILD_DIR     = @load_preference("build_dir",      __DEFAULT_KOKKOS_BUILD_DIR)
+KOKKOS_LIBS_CACHE_DIR  = @load_preference("libs_cache_dir",  __DEFAULT_KOKKOS_LIBS_CACHE_DIR)
+KOKKOS_LIBS_CACHE_SIZE = @load_preference("libs_cache_size", __DEFAULT_KOKKOS_LIBS_CACHE_SIZE)
+KOKKOS_PREBUILT_VIEWS  = @load_preference("prebuilt_views",  __DEFAULT_KOKKOS_PREBUILT_VIEWS)
 
 
 """
@@ -72,6 +78,10 @@ include("spaces.jl")
 
 include("layouts.jl")
 
+include("memory_traits.jl")
+
+include("profiling.jl")
+
 include("views.jl")
 using .Views
 
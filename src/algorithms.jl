@@ -0,0 +1,238 @@
+# Kokkos std algorithms (`Kokkos::Experimental::fill`, `copy_if`...), compiled in the 'algorithms' library.
+# Included in the `Kokkos.Views` module.
+
+export copy_if!
+
+
+# Must match `PredicateOp` in 'algorithms.cpp'
+const _PREDICATE_OPS = (==, !=, <, <=, >, >=)
+
+# Must match `TransformOp` in 'algorithms.cpp'
+const _TRANSFORM_OPS = (+, -, *, /)
+
+
+# Index of `f.f` in `ops` as the op code, or `nothing` if `f` cannot be converted to C++
+function _fix2_op(ops, f)
+    f isa Base.Fix2 || return nothing
+    i = findfirst(===(f.f), ops)
+    return isnothing(i) ? nothing : Int32(i - 1)
+end
+
+
+# `x` converted to `T`, or `nothing` if it would change the result of the operation
+function _native_operand(::Type{T}, x) where {T}
+    x isa Real || return nothing
+    y = try
+        convert(T, x)
+    catch e
+        e isa InexactError || rethrow()
+        return nothing
+    end
+    return y == x ? y : nothing
+end
+
+
+function compile_algorithms(exec_space::ExecutionSpace, view_t::Type{<:View})
+    @nospecialize exec_space view_t
+    compile_view(view_t; for_function=_fill, no_error=true)
+
+    view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(view_t)
+    DynamicCompilation.compile_and_load(@__MODULE__, "algorithms";
+        view_type, view_dim, view_layout, mem_space, mem_traits,
+        exec_space=typeof(exec_space)
+    )
+end
+
+
+function _fill(exec_space::ExecutionSpace, v::View, value)
+    @nospecialize exec_space v value
+    return DynamicCompilation.@compile_and_call(_fill, (exec_space, v, value),
+        compile_algorithms(exec_space, typeof(v))
+    )
+end
+
+
+function _copy_if(exec_space::ExecutionSpace, dest::View, src::View, op::Int32, value)
+    @nospecialize exec_space dest src op value
+    return DynamicCompilation.@compile_and_call(_copy_if, (exec_space, dest, src, op, value),
+        compile_algorithms(exec_space, typeof(src))
+    )
+end
+
+
+function _find_if(exec_space::ExecutionSpace, v::View, op::Int32, value)
+    @nospecialize exec_space v op value
+    return DynamicCompilation.@compile_and_call(_find_if, (exec_space, v, op, value),
+        compile_algorithms(exec_space, typeof(v))
+    )
+end
+
+
+function _transform(exec_space::ExecutionSpace, dest::View, src::View, op::Int32, value)
+    @nospecialize exec_space dest src op value
+    return DynamicCompilation.@compile_and_call(_transform, (exec_space, dest, src, op, value),
+        compile_algorithms(exec_space, typeof(src))
+    )
+end
+
+
+function _is_sorted(exec_space::ExecutionSpace, v::View)
+    @nospecialize exec_space v
+    return DynamicCompilation.@compile_and_call(_is_sorted, (exec_space, v),
+        compile_algorithms(exec_space, typeof(v))
+    )
+end
+
+
+function _unique(exec_space::ExecutionSpace, v::View)
+    @nospecialize exec_space v
+    return DynamicCompilation.@compile_and_call(_unique, (exec_space, v),
+        compile_algorithms(exec_space, typeof(v))
+    )
+end
+
+
+function _reverse(exec_space::ExecutionSpace, v::View)
+    @nospecialize exec_space v
+    return DynamicCompilation.@compile_and_call(_reverse, (exec_space, v),
+        compile_algorithms(exec_space, typeof(v))
+    )
+end
+
+
+"""
+    fill!(v::View, x; exec_space=nothing)
+
+Set all elements of `v` to `x` in parallel on `exec_space`, which defaults to the
+[`execution_space`](@ref) of the memory space of `v`.
+
+Equivalent to `Kokkos::Experimental::fill(exec_space, v, x)` for 1D views, and to
+`Kokkos::deep_copy(exec_space, v, x)` otherwise.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.fill!(v::View{T}, x; exec_space=nothing) where {T}
+    _fill(something(exec_space, _default_exec_space(v)), v, convert(T, x))
+    return v
+end
+
+
+"""
+    copy_if!(pred, dest::View{T, 1}, src::View{T, 1}; exec_space=nothing)
+
+Copy all elements `x` of `src` for which `pred(x)` is `true` at the start of `dest`, and return the
+number of elements copied. The order of the elements is kept. `dest` must be big enough.
+
+If `pred` is a comparison with a value (e.g. `>(0)`, `==(x)`, `!=(x)`...) and both views have the same
+type, then the copy is done in parallel on `exec_space` (defaulting to the [`execution_space`](@ref)
+of the memory space of `src`) with `Kokkos::Experimental::copy_if`. Otherwise elements are copied
+one by one from the host.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function copy_if!(pred, dest::View{T, 1}, src::View{T, 1}; exec_space=nothing) where {T}
+    op = _fix2_op(_PREDICATE_OPS, pred)
+    value = isnothing(op) ? nothing : _native_operand(T, pred.x)
+    if !isnothing(value) && T <: NativeReductionTypes && typeof(dest) === typeof(src)
+        if length(dest) < length(src)
+            # Kokkos does not check if the destination is big enough
+            throw(DimensionMismatch("destination of length $(length(dest)) is shorter than the source \
+                                     of length $(length(src))"))
+        end
+        return _copy_if(something(exec_space, _default_exec_space(src)), dest, src, op, value)
+    end
+
+    n = 0
+    for x in src
+        pred(x) || continue
+        n += 1
+        dest[n] = x
+    end
+    return n
+end
+
+
+"""
+    findfirst(pred, v::View{T, 1}; exec_space=nothing)
+
+Equivalent to `Kokkos::Experimental::find_if` when `pred` is a comparison with a value (e.g. `>(0)`,
+`==(x)`...), otherwise falls back to the generic method.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.findfirst(pred::Base.Fix2, v::View{T, 1}; exec_space=nothing) where {T}
+    op = _fix2_op(_PREDICATE_OPS, pred)
+    value = isnothing(op) ? nothing : _native_operand(T, pred.x)
+    if isnothing(value) || !(T <: NativeReductionTypes)
+        return invoke(findfirst, Tuple{Function, AbstractArray}, pred, v)
+    end
+    i = _find_if(something(exec_space, _default_exec_space(v)), v, op, value)
+    return i == length(v) ? nothing : i + 1
+end
+
+
+"""
+    map!(f, dest::View{T, 1}, src::View{T, 1}; exec_space=nothing)
+
+Equivalent to `Kokkos::Experimental::transform` when `f` is an arithmetic operation with a value
+(`+(x)`, `-(x)`, `*(x)` or `/(x)`, with `Base.Fix2`) which does not change the element type, and
+both views have the same type and length. Otherwise falls back to the generic method.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.map!(f::Base.Fix2, dest::View{T, 1}, src::View{T, 1}; exec_space=nothing) where {T}
+    op = _fix2_op(_TRANSFORM_OPS, f)
+    value = isnothing(op) ? nothing : _native_operand(T, f.x)
+    if isnothing(value) || !(T <: NativeReductionTypes) || Base.promote_op(f.f, T, T) !== T ||
+            typeof(dest) !== typeof(src) || length(dest) != length(src)
+        return invoke(map!, Tuple{Any, AbstractArray, AbstractArray}, f, dest, src)
+    end
+    _transform(something(exec_space, _default_exec_space(src)), dest, src, op, value)
+    return dest
+end
+
+
+"""
+    unique!(v::View{T, 1}; exec_space=nothing)
+    unique(v::View{T, 1}; exec_space=nothing)
+
+For sorted views, remove consecutive duplicates with `Kokkos::Experimental::unique`. `unique!`
+returns a [`subview`](@ref) of `v` containing only the unique elements. Views cannot be resized,
+therefore elements after the returned subview are left in an unspecified state.
+`unique` does the same on a copy of `v`, and always returns a `Vector{T}`, like the generic method.
+
+Elements are compared with `isequal`, like in Julia: `NaN`s are duplicates of each other, while
+`-0.0` and `0.0` are not. Views are sorted if `issorted(v)` (by `isless`).
+
+Views which are not sorted fall back to the generic methods (which fails for `unique!`).
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.unique!(v::View{T, 1}; exec_space=nothing) where {T}
+    !(T <: NativeReductionTypes) && return invoke(unique!, Tuple{AbstractVector}, v)
+    exec_space = something(exec_space, _default_exec_space(v))
+    !_is_sorted(exec_space, v) && return invoke(unique!, Tuple{AbstractVector}, v)
+    n = _unique(exec_space, v)
+    return subview(v, (1:n,))
+end
+
+
+function Base.unique(v::View{T, 1}; exec_space=nothing) where {T}
+    !(T <: NativeReductionTypes) && return invoke(unique, Tuple{AbstractArray}, v)
+    exec_space = something(exec_space, _default_exec_space(v))
+    !_is_sorted(exec_space, v) && return invoke(unique, Tuple{AbstractArray}, v)
+    return Array(unique!(copy(v); exec_space))
+end
+
+
+"""
+    reverse!(v::View{T, 1}; exec_space=nothing)
+
+Equivalent to `Kokkos::Experimental::reverse`.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.reverse!(v::View{T, 1}; exec_space=nothing) where {T <: NativeReductionTypes}
+    _reverse(something(exec_space, _default_exec_space(v)), v)
+    return v
+end
@@ -0,0 +1,173 @@
+# In-place broadcasting of views fused into a single `Kokkos::parallel_for`, compiled in the
+# 'broadcast' library.
+# Included in the `Kokkos.Views` module.
+
+import Base.Broadcast: Broadcasted
+
+
+# Element types for which broadcast expressions are translated to C++
+const FusedBroadcastTypes = Union{Float32, Float64}
+
+
+# Operators of broadcast expressions, with any number of arguments
+const _BROADCAST_OPERATORS = Dict{Function, String}(
+    (+) => "+", (-) => "-", (*) => "*", (/) => "/"
+)
+
+# Functions of broadcast expressions, with their C++ name (see 'broadcast.cpp') and their number of
+# arguments
+const _BROADCAST_FUNCTIONS = Dict{Function, Tuple{String, Int}}(
+    sqrt => ("broadcast_math::sqrt", 1), cbrt => ("broadcast_math::cbrt", 1), abs => ("broadcast_math::fabs", 1),
+    exp => ("broadcast_math::exp", 1), log => ("broadcast_math::log", 1), log10 => ("broadcast_math::log10", 1),
+    sin => ("broadcast_math::sin", 1), cos => ("broadcast_math::cos", 1), tan => ("broadcast_math::tan", 1),
+    tanh => ("broadcast_math::tanh", 1), floor => ("broadcast_math::floor", 1), ceil => ("broadcast_math::ceil", 1),
+    # `fmin` and `fmax` ignore NaNs, unlike `min` and `max`
+    min => ("julia_min", 2), max => ("julia_max", 2),
+    (^) => ("broadcast_math::pow", 2), hypot => ("broadcast_math::hypot", 2),
+    fma => ("broadcast_math::fma", 3), muladd => ("broadcast_math::fma", 3)
+)
+
+
+# Loaded kernels, by expression, view type, number of view and scalar operands, and execution space
+const _BROADCAST_KERNELS = Dict{Tuple{String, DataType, Int, Int, DataType}, Any}()
+const _BROADCAST_KERNELS_LOCK = ReentrantLock()
+
+
+function _data_overlaps(a::View{T}, b::View{T}) where {T}
+    (isempty(a) || isempty(b)) && return false
+    span(v) = (sum((size(v) .- 1) .* strides(v); init=0) + 1) * sizeof(T)
+    pa, pb = UInt(pointer(a)), UInt(pointer(b))
+    return pa < pb + span(b) && pb < pa + span(a)
+end
+
+
+"""
+    _broadcast_expr(dest::View, bc::Broadcasted)
+
+Translate `bc` into a C++ expression of the views and scalars it uses, or return `nothing` if it
+cannot be fused into a broadcast kernel.
+
+View operands are written as `BC_VIEW(i)` and scalars as `BC_SCALAR(i)`, with `i` the index (from
+0) in the returned lists of unique views and scalars. All views must have the same type and size as
+`dest`, without sharing any memory with it (except `dest` itself). Scalars are converted to the
+element type of `dest`.
+"""
+function _broadcast_expr(dest::View{T}, bc::Broadcasted) where {T}
+    views = View[]
+    scalars = T[]
+    expr = _broadcast_expr!(views, scalars, dest, bc)
+    return expr, views, scalars
+end
+
+
+_unwrap_ref(x) = x isa Base.RefValue ? x[] : x
+
+
+function _broadcast_expr!(views, scalars, dest::View{T}, arg) where {T}
+    if arg isa View
+        (typeof(arg) !== typeof(dest) || size(arg) != size(dest)) && return nothing
+        arg !== dest && _data_overlaps(arg, dest) && return nothing
+        i = findfirst(v -> v === arg, views)
+        isnothing(i) && (push!(views, arg); i = length(views))
+        return "BC_VIEW($(i - 1))"
+    elseif arg isa Union{Real, Base.RefValue{<:Real}}
+        push!(scalars, convert(T, arg isa Real ? arg : arg[]))
+        return "BC_SCALAR($(length(scalars) - 1))"
+    elseif !(arg isa Broadcasted)
+        return nothing
+    end
+
+    f, args = arg.f, arg.args
+    if f === Base.literal_pow && length(args) == 3 && _unwrap_ref(args[1]) === (^) && _unwrap_ref(args[3]) isa Val
+        # `x .^ p` with a literal integer `p`
+        base = _broadcast_expr!(views, scalars, dest, args[2])
+        isnothing(base) && return nothing
+        p = typeof(_unwrap_ref(args[3])).parameters[1]
+        !(p isa Integer) && return nothing
+        return p == 2 ? "($base * $base)" : "broadcast_math::pow($base, T($p))"
+    end
+
+    args_expr = map(a -> _broadcast_expr!(views, scalars, dest, a), args)
+    any(isnothing, args_expr) && return nothing
+
+    if f === identity && length(args_expr) == 1
+        return args_expr[1]
+    elseif haskey(_BROADCAST_OPERATORS, f)
+        op = _BROADCAST_OPERATORS[f]
+        if length(args_expr) == 1
+            return f === (/) ? nothing : "($op$(args_expr[1]))"
+        elseif length(args_expr) > 2 && (f === (-) || f === (/))
+            return nothing
+        end
+        return "(" * join(args_expr, " $op ") * ")"
+    elseif haskey(_BROADCAST_FUNCTIONS, f)
+        name, arg_count = _BROADCAST_FUNCTIONS[f]
+        length(args_expr) != arg_count && return nothing
+        return "$name(" * join(args_expr, ", ") * ")"
+    else
+        return nothing
+    end
+end
+
+
+function compile_broadcast(exec_space::ExecutionSpace, view_t::Type{<:View}, expr, n_views, n_scalars)
+    @nospecialize exec_space view_t
+    compile_view(view_t; for_function=_broadcast!, no_error=true)
+
+    view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(view_t)
+    impl_module = DynamicCompilation.compile_and_load(@__MODULE__, "broadcast";
+        view_type, view_dim, view_layout, mem_space, mem_traits,
+        exec_space=typeof(exec_space),
+        broadcast_expr=expr, broadcast_views=n_views, broadcast_scalars=n_scalars
+    )
+    return impl_module._broadcast_kernel
+end
+
+
+function _broadcast!(exec_space::ExecutionSpace, dest::View, expr::String, views, scalars)
+    @nospecialize exec_space dest views scalars
+    key = (expr, typeof(dest), length(views), length(scalars), typeof(exec_space))
+    kernel = lock(() -> get(_BROADCAST_KERNELS, key, nothing), _BROADCAST_KERNELS_LOCK)
+    if isnothing(kernel)
+        # Compilation is already protected by `DynamicCompilation.compilation_lock`
+        kernel = compile_broadcast(exec_space, typeof(dest), expr, length(views), length(scalars))
+        lock(() -> (_BROADCAST_KERNELS[key] = kernel), _BROADCAST_KERNELS_LOCK)
+    end
+    Base.invokelatest(kernel, exec_space, dest, views..., scalars...)
+    return dest
+end
+
+
+"""
+    copyto!(dest::View, bc::Broadcasted)
+
+In-place broadcasting into a `View`: `dest .= a .* b .+ c`.
+
+Simple elementwise expressions are fused into a single `Kokkos::parallel_for`, done in parallel on
+the [`execution_space`](@ref) of the memory space of `dest`. This is the case if:
+ - `dest` has `Float32` or `Float64` elements,
+ - all other operands are either views of the same type and size as `dest` (without any dimension
+   to broadcast) which do not share their memory with `dest` (except `dest` itself), or real
+   scalars (converted to the element type of `dest`),
+ - the expression contains only arithmetic operators (`+`, `-`, `*`, `/`), literal integer powers,
+   and the functions `sqrt`, `cbrt`, `abs`, `exp`, `log`, `log10`, `sin`, `cos`, `tan`, `tanh`,
+   `floor`, `ceil`, `min`, `max`, `^`, `hypot`, `fma` and `muladd`.
+
+A kernel is compiled for each new expression, view type and execution space.
+All other broadcasts fall back to the generic method.
+
+Fused expressions follow the semantics of the C++ math functions: where Julia would throw a
+`DomainError` (e.g. `sqrt(-1.0)`, `log(-1.0)` or `(-1.0)^0.5`), the result is a `NaN` instead.
+`min` and `max` return `NaN` if any of their arguments is `NaN`, like in Julia.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.copyto!(dest::View{T}, bc::Broadcasted{Nothing}) where {T}
+    if T <: FusedBroadcastTypes && axes(dest) == axes(bc)
+        expr, views, scalars = _broadcast_expr(dest, bc)
+        if !isnothing(expr)
+            return _broadcast!(_default_exec_space(dest), dest, expr, views, scalars)
+        end
+    end
+    return invoke(copyto!, Tuple{AbstractArray, Broadcasted{Nothing}}, dest, bc)
+end
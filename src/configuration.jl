@@ -127,6 +127,54 @@ function set_build_dir(build_dir::Union{Nothing, Missing, AbstractString}; local
 end
 
 
+function set_libs_cache_dir(cache_dir::Union{Nothing, Missing, AbstractString})
+    @set_preferences!("libs_cache_dir" => cache_dir)
+    if !is_kokkos_wrapper_loaded()
+        global KOKKOS_LIBS_CACHE_DIR = @load_preference("libs_cache_dir", __DEFAULT_KOKKOS_LIBS_CACHE_DIR)
+    else
+        global HAS_CONFIGURATION_CHANGED = true
+        @info "New compiled libraries cache directory set to $cache_dir.\n\
+               Restart your Julia session for this change to take effect."
+    end
+    return KOKKOS_LIBS_CACHE_DIR
+end
+
+
+function set_libs_cache_size(max_size::Union{Nothing, Missing, Integer})
+    @set_preferences!("libs_cache_size" => max_size)
+    global KOKKOS_LIBS_CACHE_SIZE = @load_preference("libs_cache_size", __DEFAULT_KOKKOS_LIBS_CACHE_SIZE)
+    return KOKKOS_LIBS_CACHE_SIZE
+end
+
+
+function set_prebuilt_views(views::Union{Nothing, Missing, Dict{String, <:Any}})
+    @set_preferences!("prebuilt_views" => views)
+    if !is_kokkos_wrapper_loaded()
+        global KOKKOS_PREBUILT_VIEWS = @load_preference("prebuilt_views", __DEFAULT_KOKKOS_PREBUILT_VIEWS)
+    else
+        global HAS_CONFIGURATION_CHANGED = true
+        @info "New prebuilt views set to $views.\n\
+               Restart your Julia session for this change to take effect."
+    end
+    return KOKKOS_PREBUILT_VIEWS
+end
+
+function set_prebuilt_views(;
+    types = [Float64, Float32, Int64],
+    dims = 1:3,
+    layouts = [LayoutLeft, LayoutRight],
+    mem_spaces = nothing
+)
+    views = Dict{String, Any}(
+        "types" => string.(nameof.(types)),
+        "dims" => collect(Int, dims),
+        "layouts" => string.(nameof.(layouts))
+    )
+    !isnothing(mem_spaces) && (views["mem_spaces"] = string.(nameof.(mem_spaces)))
+    return set_prebuilt_views(views)
+end
+
+
 """
     build_in_scratch()
 
@@ -1,18 +1,23 @@
 module DynamicCompilation
 
-import ..Kokkos: Wrapper
+import ..Kokkos: Wrapper, KOKKOS_VERSION, KOKKOS_PATH, LOCAL_KOKKOS_DIR
+import ..Kokkos: KOKKOS_BUILD_TYPE, KOKKOS_BACKENDS, KOKKOS_CMAKE_OPTIONS, KOKKOS_LIB_OPTIONS
+import ..Kokkos: KOKKOS_LIBS_CACHE_SIZE
 import ..Kokkos: CMakeKokkosProject, CLibrary
-import ..Kokkos: ensure_kokkos_wrapper_loaded, compile, lib_path, load_lib, __validate_parameters
+import ..Kokkos: ensure_kokkos_wrapper_loaded, compile, build_dir, load_lib, __validate_parameters
+import ..Kokkos: configuration_changed!
 
 import FileWatching.Pidfile: mkpidlock
+import SHA: sha1
 
 
-export @compile_and_call, compile_and_load
+export @compile_and_call, compile_and_load, compile_batch
 
 
-const COMPILATION_LOCK_FILE = "__compilation.lock"
+const COMPILATION_LOCKS_DIR = "__compilation_locks"
 const PROCESS_ID = rand(Cint)  # getpid() is not guaranteed to be unique in an MPI app
-const INTRA_PROCESS_LOCK = ReentrantLock()  # Multi-threading lock
+const INTRA_PROCESS_LOCKS = Dict{String, ReentrantLock}()  # Multi-threading locks, one for each lib
+const INTRA_PROCESS_LOCKS_LOCK = ReentrantLock()
 
 
 const LOADED_FUNCTION_LIBS = Dict{String, CLibrary}()
@@ -20,13 +25,17 @@ const NEXT_LIB_NUMBER = Ref(0)
 const LOAD_LIB_LOCK = ReentrantLock()
 
 
-# CMake targets to their output
-const CMAKE_TARGETS = Dict{String, String}(
-    "views" => "libviews_out",
-    "copy" => "libcopy_out",
-    "mirrors" => "libmirrors_out",
-    "subviews" => "libsubviews_out"
-)
+# All sub-libraries, compiled from 'lib/kokkos_wrapper/sub_libraries/<name>.cpp'
+const SUB_LIBRARIES = ("views", "copy", "mirrors", "subviews", "reductions", "algorithms", "sort",
+                       "broadcast", "kernel")
+
+
+# CMake project building instances of the sub-libraries in batches
+const INSTANCES_PROJECT_DIR = joinpath(@__DIR__, "../lib/kokkos_wrapper/instances")
+
+# Number of persistent build directories of the instances project, which is also the maximum number
+# of compilations in parallel
+const INSTANCES_BUILD_DIRS = 4
 
 
 const SHARED_LIB_EXT = @static if Sys.iswindows()
@@ -45,6 +54,8 @@ Remove all shared libraries generated for compilation on demand of some methods
 
 Libraries are not unloaded, therefore subsequent calls to [`compile_and_load`](@ref) might not
 trigger recompilation.
+
+If the [libs_cache_dir](@ref) is shared, libraries of all other users are also removed.
 """
 function clean_libs()
     for file in readdir(Wrapper.get_kokkos_func_libs_dir(); join=true)
@@ -65,15 +76,18 @@ function use_compilation_lock()
 end
 
 
-lock_file_path() = joinpath(Wrapper.KOKKOS_BUILD_DIR, COMPILATION_LOCK_FILE)
+locks_dir() = joinpath(Wrapper.KOKKOS_BUILD_DIR, COMPILATION_LOCKS_DIR)
+lock_file_path(name) = joinpath(locks_dir(), name * ".lock")
 
-Wrapper.clear_compilation_lock() = rm(lock_file_path(); force=true)
+Wrapper.clear_compilation_lock() = rm(locks_dir(); recursive=true, force=true)
 
 
 """
-    compilation_lock(func)
+    compilation_lock(func, name)
 
-Asserts that only a single process (and single thread) is compiling at once.
+Asserts that only a single process (and single thread) is compiling the library `name` at once.
+Different libraries can be compiled at the same time, since each library is built in its own
+directory.
 
 By default, there is only a lock on tasks of the current process.
 
@@ -89,21 +103,188 @@ Note that it is not the current process' ID that is used in the PID lock file, s
 guaranteed to be unique in a MPI application. Instead a random 32-bit number is used, constant for
 this process.
 """
-function compilation_lock(func)
-    lock(INTRA_PROCESS_LOCK) do
+function compilation_lock(func, name)
+    name_lock = lock(INTRA_PROCESS_LOCKS_LOCK) do
+        get!(ReentrantLock, INTRA_PROCESS_LOCKS, name)
+    end
+    lock(name_lock) do
         !use_compilation_lock() && return func()
-        return mkpidlock(func, lock_file_path(), PROCESS_ID; stale_age=0, wait=true, poll_interval=5)
+        mkpath(locks_dir())
+        return mkpidlock(func, lock_file_path(name), PROCESS_ID; stale_age=0, wait=true, poll_interval=5)
+    end
+end
+
+
+# `compilation_lock` for all `names`, nested in their order
+function compilation_locks(func, names)
+    isempty(names) && return func()
+    return compilation_lock(first(names)) do
+        compilation_locks(func, names[2:end])
+    end
+end
+
+
+instances_dir() = joinpath(build_dir(Wrapper.KOKKOS_LIB_PROJECT), "instances")
+
+
+# The PID lock file of `name` if it was acquired without waiting, `false` if another process holds
+# it, or `nothing` if lock files are not used (see `compilation_lock`)
+function try_pid_lock(name)
+    !use_compilation_lock() && return nothing
+    mkpath(locks_dir())
+    try
+        return mkpidlock(lock_file_path(name), PROCESS_ID; stale_age=0, wait=false)
+    catch
+        # The type of the error thrown when the file is locked changed between Julia versions
+        return false
+    end
+end
+
+
+"""
+    instances_build_dir(func)
+
+Call `func(build_dir)` with one of the persistent build directories of the instances project, while
+holding its lock. Build directories not used by other tasks or processes are preferred.
+
+Build directories are configured once and kept between compilations, only their manifest changes.
+"""
+function instances_build_dir(func)
+    names = ["instances_build_$i" for i in 1:INSTANCES_BUILD_DIRS]
+    dir_path(idx) = joinpath(instances_dir(), "build_$idx")
+    dir_locks = lock(INTRA_PROCESS_LOCKS_LOCK) do
+        [get!(ReentrantLock, INTRA_PROCESS_LOCKS, name) for name in names]
+    end
+
+    # Try all directories without waiting, starting from a random one to spread the processes
+    first_idx = rand(1:INSTANCES_BUILD_DIRS)
+    for i in 0:INSTANCES_BUILD_DIRS-1
+        idx = mod1(first_idx + i, INSTANCES_BUILD_DIRS)
+        trylock(dir_locks[idx]) || continue
+        try
+            pid_lock = try_pid_lock(names[idx])
+            pid_lock === false && continue
+            try
+                return func(dir_path(idx))
+            finally
+                !isnothing(pid_lock) && close(pid_lock)
+            end
+        finally
+            unlock(dir_locks[idx])
+        end
+    end
+
+    # All directories are busy: wait for one of them
+    return compilation_lock(names[first_idx]) do
+        func(dir_path(first_idx))
     end
 end
 
 
+const BUILD_CONFIG_ID = Ref{String}("")
+
+
+"""
+    build_config_id()
+
+Hash of everything which changes the dynamically compiled libraries, apart from their parameters:
+Kokkos version and configuration options, compiler identity and flags, CxxWrap and Julia versions,
+and the sources of the wrapper library.
+
+Part of the name of each compiled library: libraries are stored in a content-addressed cache, which
+stays valid across rebuilds of the wrapper library, and can be shared across users and nodes as long
+as their configuration is the same (see [libs_cache_dir](@ref)).
+"""
+function build_config_id()
+    !isempty(BUILD_CONFIG_ID[]) && return BUILD_CONFIG_ID[]
+    ensure_kokkos_wrapper_loaded()
+
+    compiler_id_file = joinpath(build_dir(Wrapper.KOKKOS_LIB_PROJECT), "compiler_id.txt")
+    compiler_id = isfile(compiler_id_file) ? read(compiler_id_file, String) : "<unknown compiler>"
+
+    config = IOBuffer()
+    println(config, "Kokkos ", KOKKOS_VERSION)
+    # The path of the packaged Kokkos sources is different for each user, but not its contents
+    KOKKOS_PATH != LOCAL_KOKKOS_DIR && println(config, "Kokkos path: ", KOKKOS_PATH)
+    println(config, "Build type: ", KOKKOS_BUILD_TYPE)
+    println(config, "Backends: ", join(sort(uppercase.(KOKKOS_BACKENDS)), ", "))
+    println(config, "Kokkos options: ", join(sort(KOKKOS_LIB_OPTIONS), " "))
+    println(config, "CMake options: ", join(KOKKOS_CMAKE_OPTIONS, " "))
+    println(config, "Compiler: ", compiler_id)
+    println(config, "CxxWrap ", pkgversion(parentmodule(@__MODULE__).CxxWrap))
+    println(config, "Julia ", VERSION.major, ".", VERSION.minor)
+
+    wrapper_dir = joinpath(@__DIR__, "../lib/kokkos_wrapper")
+    # The CMake projects building the libraries are part of the configuration as well
+    wrapper_dirs = (wrapper_dir, joinpath(wrapper_dir, "sub_libraries"), joinpath(wrapper_dir, "instances"))
+    for dir in wrapper_dirs, file in sort(readdir(dir))
+        (file == "CMakeLists.txt" || any(ext -> endswith(file, ext), (".h", ".cpp", ".sh"))) || continue
+        println(config, file)
+        write(config, read(joinpath(dir, file)))
+    end
+
+    return BUILD_CONFIG_ID[] = bytes2hex(sha1(take!(config)))
+end
+
+
+function cached_lib_name(lib_name)
+    # The first 80 bits of the hash are more than enough to avoid collisions
+    key = bytes2hex(sha1(build_config_id() * lib_name))[1:20]
+    return splitext(lib_name)[1] * "-" * key * SHARED_LIB_EXT
+end
+
+
+"""
+    evict_libs(; max_size=KOKKOS_LIBS_CACHE_SIZE, libs_dir=nothing)
+
+Remove the least recently used libraries from the cache of compiled libraries until its total size
+is below `max_size` bytes (see [libs_cache_size](@ref)). Libraries loaded in the current session are
+never removed.
+
+`libs_dir` defaults to [`Wrapper.get_kokkos_func_libs_dir`](@ref).
+
+Called after each compilation. Returns the number of libraries removed.
+"""
+function evict_libs(; max_size=KOKKOS_LIBS_CACHE_SIZE, libs_dir=nothing)
+    isnothing(max_size) && return 0
+    libs_dir = something(libs_dir, Wrapper.get_kokkos_func_libs_dir())
+
+    libs = map(filter(endswith(SHARED_LIB_EXT), readdir(libs_dir; join=true))) do lib
+        lib_stat = stat(lib)
+        return (; path=lib, size=lib_stat.size, mtime=lib_stat.mtime)
+    end
+
+    total_size = sum(lib -> lib.size, libs; init=0)
+    total_size ≤ max_size && return 0
+
+    loaded_libs = lock(LOAD_LIB_LOCK) do
+        Set(lib.load_path for lib in values(LOADED_FUNCTION_LIBS))
+    end
+
+    removed = 0
+    for lib in sort!(libs; by=lib -> lib.mtime)
+        total_size ≤ max_size && break
+        lib.path in loaded_libs && continue
+        # Another process sharing the cache might have removed it already
+        rm(lib.path; force=true)
+        total_size -= lib.size
+        removed += 1
+    end
+
+    @debug "Evicted $removed libs from the cache at '$libs_dir'"
+    return removed
+end
+
+
 function build_lib_name(
     cmake_target,
     view_layout, view_dim, view_type,
-    exec_space, mem_space,
-    dest_layout, dest_space,
+    exec_space, mem_space, mem_traits,
+    dest_layout, dest_space, dest_mem_traits,
     without_exec_space_arg, with_nothing_arg,
-    subview_dim
+    subview_dim,
+    broadcast_expr, broadcast_views, broadcast_scalars,
+    kernel_source
 )
     # All arguments are strings
     parts = [cmake_target]
@@ -113,41 +294,63 @@ function build_lib_name(
     !isempty(view_type)    && push!(parts, view_type)
     !isempty(exec_space)   && push!(parts, exec_space)
     !isempty(mem_space)    && push!(parts, mem_space)
+    !isempty(mem_traits)   && push!(parts, "MT" * mem_traits)
 
-    if !isempty(dest_layout) || !isempty(dest_space) || !isempty(subview_dim)
+    if !isempty(dest_layout) || !isempty(dest_space) || !isempty(dest_mem_traits) || !isempty(subview_dim)
         push!(parts, "to")
     end
 
     !isempty(dest_layout)  && push!(parts, uppercase(dest_layout[1:1]))
     !isempty(dest_space)   && push!(parts, dest_space)
+    !isempty(dest_mem_traits) && push!(parts, "MT" * dest_mem_traits)
     !isempty(subview_dim)  && push!(parts, subview_dim)
 
     without_exec_space_arg && push!(parts, "no_exec")
     with_nothing_arg       && push!(parts, "with_default")
 
+    if !isempty(broadcast_expr)
+        # The expression cannot be part of a file name, but its hash can
+        push!(parts, "V" * broadcast_views, "S" * broadcast_scalars, bytes2hex(sha1(broadcast_expr))[1:16])
+    end
+
+    !isempty(kernel_source) && push!(parts, "K" * bytes2hex(sha1(kernel_source))[1:16])
+
     return join(parts, "_") * SHARED_LIB_EXT
 end
 
 
-function is_lib_up_to_date(lib_path)
-    !isfile(lib_path) && return false
-    ensure_kokkos_wrapper_loaded()
-    wrapper_lib_path = Wrapper.KOKKOS_LIB_PATH * SHARED_LIB_EXT
-    !isfile(wrapper_lib_path) && error("Could not find the wrapper lib at '$wrapper_lib_path'")
-    return mtime(wrapper_lib_path) ≤ mtime(lib_path)
+# Libraries are content-addressed (see `build_config_id`): if it exists, then it is up to date
+is_lib_up_to_date(lib_path) = isfile(lib_path)
+
+
+function mark_lib_as_used(lib_path)
+    # The modification time is used for the LRU eviction
+    try
+        touch(lib_path)
+    catch e
+        # The cache might be shared and read-only
+        e isa Base.IOError || rethrow()
+    end
 end
 
 
 function build_compilation_parameters(
     view_layout, view_dim, view_type,
-    exec_space, mem_space,
-    dest_layout, dest_space,
+    exec_space, mem_space, mem_traits,
+    dest_layout, dest_space, dest_mem_traits,
     without_exec_space_arg, with_nothing_arg,
-    subview_dim
+    subview_dim,
+    broadcast_expr, broadcast_views, broadcast_scalars,
+    kernel_source
 )
     # Special case for parameters which should have a default value
     dest_layout = isempty(dest_layout) ? "NONE" : dest_layout
     subview_dim = isempty(subview_dim) ? "0"    : subview_dim
+    mem_traits  = isempty(mem_traits)  ? "0"    : mem_traits
+    dest_mem_traits = isempty(dest_mem_traits) ? mem_traits : dest_mem_traits
+    broadcast_expr    = isempty(broadcast_expr)    ? "0" : broadcast_expr
+    broadcast_views   = isempty(broadcast_views)   ? "0" : broadcast_views
+    broadcast_scalars = isempty(broadcast_scalars) ? "0" : broadcast_scalars
 
     # Those are environment variables which will their respective macros in the C++ lib.
     # See 'lib/kokkos_wrapper/build_parameters.sh'
@@ -157,30 +360,31 @@ function build_compilation_parameters(
         "VIEW_TYPE" => view_type,
         "EXEC_SPACE" => exec_space,
         "MEM_SPACE" => mem_space,
+        "VIEW_MEM_TRAITS" => mem_traits,
         "DEST_LAYOUT" => dest_layout,
         "DEST_MEM_SPACE" => dest_space,
+        "DEST_MEM_TRAITS" => dest_mem_traits,
         "WITHOUT_EXEC_SPACE_ARG" => Int(without_exec_space_arg),
         "WITH_NOTHING_ARG" => Int(with_nothing_arg),
-        "SUBVIEW_DIM" => subview_dim
+        "SUBVIEW_DIM" => subview_dim,
+        "BROADCAST_EXPR" => broadcast_expr,
+        "BROADCAST_VIEWS" => broadcast_views,
+        "BROADCAST_SCALARS" => broadcast_scalars,
+        "KERNEL_SOURCE" => kernel_source
     )
 end
 
 
 function compile_lib(cmake_target, out_lib_path, parameters)
     ensure_kokkos_wrapper_loaded()
-    compilation_lock() do
+    lib_name = basename(out_lib_path)
+    compilation_lock(lib_name) do
         # The lock may have been acquired after another process compiled the library, therefore we
         # must check if the library is up to date again.
         is_lib_up_to_date(out_lib_path) && return
-
-        target_output = CMAKE_TARGETS[cmake_target]
-
-        lib_proj = CMakeKokkosProject(Wrapper.KOKKOS_LIB_PROJECT, cmake_target, target_output)
-        compile(lib_proj; cmd_transform=cmd -> addenv(cmd, parameters))
-
-        output_path = lib_path(lib_proj) * SHARED_LIB_EXT
-        mv(output_path, out_lib_path; force=true)
+        compile_instances([lib_name => (cmake_target, parameters)])
     end
+    evict_libs()
 end
 
 
@@ -206,85 +410,249 @@ function register_new_functions(current_module, lib_path, lib_name)
         module_expr = module_expr.args[2]  # Needed because of the error '"module" expression not at top level'
 
         Core.eval(current_module, module_expr)
+        return getfield(current_module, name)
     end
 end
 
 
-"""
-    compile_and_load(current_module, cmake_target; kwargs...)
+function sub_libraries_pch_options()
+    # The precompiled header of the sub-libraries is built along with the wrapper library, see
+    # 'lib/kokkos_wrapper/sub_libraries/CMakeLists.txt'
+    pch_file = joinpath(build_dir(Wrapper.KOKKOS_LIB_PROJECT), "sub_libraries_pch.txt")
+    !isfile(pch_file) && return String[]
+    pch_compiler, pch_path = split(read(pch_file, String), '\n'; limit=2)
+    return ["-DSUB_LIBRARIES_PCH=$pch_path", "-DSUB_LIBRARIES_PCH_COMPILER=$pch_compiler"]
+end
 
-Check if the library of `cmake_target` compiled with `kwargs` exists, if not compile it, then load
-it.
 
-The library is a CxxWrap module, which is then loaded into `current_module` in the sub-module
-`Impl<number>` with '<number>' the total count of calls to `compile_and_load` in this Julia session.
-"""
-function compile_and_load(current_module, cmake_target;
+function compile_instances(instances)
+    instances_build_dir() do dir
+        compile_instances(instances, dir)
+    end
+end
+
+
+function compile_instances(instances, instances_build_dir)
+    # `instances` is a list of `lib_name => (cmake_target, parameters)`.
+    # Each instance has its own 'build_parameters.h' and build directory, see 'lib/kokkos_wrapper/instances'.
+    libs_dir = Wrapper.get_kokkos_func_libs_dir()
+
+    # A build directory configured for another build configuration cannot be reused
+    config_id_path = joinpath(instances_build_dir, "build_config_id.txt")
+    if !isfile(config_id_path) || read(config_id_path, String) != build_config_id()
+        rm(instances_build_dir; recursive=true, force=true)
+        mkpath(instances_build_dir)
+        write(config_id_path, build_config_id())
+    end
+
+    manifest_path = joinpath(instances_build_dir, "instances_manifest.cmake")
+    instance_libs = Dict{String, String}()
+    open(manifest_path, "w") do manifest
+        for (i, (lib_name, (cmake_target, parameters))) in enumerate(instances)
+            # CMake target names cannot contain all characters present in a lib name
+            instance_name = "instance_$i"
+            instance_libs[instance_name] = lib_name
+
+            # The source of a kernel is not a macro but a header in the instance's directory, which is
+            # in its include path.
+            kernel_source = get(parameters, "KERNEL_SOURCE", "")
+            if !isempty(kernel_source)
+                mkpath(joinpath(instances_build_dir, instance_name))
+                write(joinpath(instances_build_dir, instance_name, "kernel_source.h"), kernel_source)
+            end
+
+            parameters_str = join(("\"$name=$value\"" for (name, value) in parameters if name != "KERNEL_SOURCE"), " ")
+            println(manifest, "add_instance($instance_name $cmake_target $parameters_str)")
+        end
+    end
+
+    cmake_options = ["-DINSTANCES_MANIFEST=$manifest_path"]
+    append!(cmake_options, sub_libraries_pch_options())
+
+    instances_proj = CMakeKokkosProject(INSTANCES_PROJECT_DIR, "";
+        build_dir = instances_build_dir,
+        build_type = KOKKOS_BUILD_TYPE,
+        cmake_options
+    )
+    if isfile(joinpath(instances_build_dir, "CMakeCache.txt"))
+        # The manifest is included by the project: CMake regenerates the build system by itself
+        # when it changes, which is much faster than configuring it again from scratch.
+        configuration_changed!(instances_proj, false)
+    end
+    compile(instances_proj)
+
+    for (instance_name, lib_name) in instance_libs
+        instance_lib_path = joinpath(instances_build_dir, instance_name, instance_name * SHARED_LIB_EXT)
+        # The cache might be on another filesystem: move in two steps to make sure that the
+        # library is never visible while incomplete by other processes.
+        tmp_lib_path = joinpath(libs_dir, "$lib_name.$PROCESS_ID.tmp")
+        mv(instance_lib_path, tmp_lib_path; force=true)
+        mv(tmp_lib_path, joinpath(libs_dir, lib_name); force=true)
+    end
+end
+
+
+function lib_name_and_parameters(cmake_target;
     view_layout = nothing,
     view_dim = nothing,
     view_type = nothing,
     exec_space = nothing,
     mem_space = nothing,
+    mem_traits = nothing,
     dest_layout = nothing,
     dest_space = nothing,
+    dest_mem_traits = nothing,
     without_exec_space_arg = false,
     with_nothing_arg = false,
-    subview_dim = nothing
+    subview_dim = nothing,
+    broadcast_expr = nothing,
+    broadcast_views = nothing,
+    broadcast_scalars = nothing,
+    kernel_source = nothing
 )
+    if !(cmake_target in SUB_LIBRARIES)
+        error("unknown sub-library: '$cmake_target'")
+    end
+
     view_layout, view_dim, view_type,
-        exec_space, mem_space,
-        dest_layout, dest_space,
+        exec_space, mem_space, mem_traits,
+        dest_layout, dest_space, dest_mem_traits,
         subview_dim = __validate_parameters(;
             view_layout, view_dim, view_type,
-            exec_space, mem_space,
-            dest_layout, dest_space,
+            exec_space, mem_space, mem_traits,
+            dest_layout, dest_space, dest_mem_traits,
             subview_dim
     )
 
-    @debug "Compiling $cmake_target with:\n\t$(join([
+    # `broadcast_expr` is a C++ expression, built by `Kokkos.Views._broadcast_expr`
+    broadcast_expr    = isnothing(broadcast_expr)    ? "" : string(broadcast_expr)
+    broadcast_views   = isnothing(broadcast_views)   ? "" : string(broadcast_views)
+    broadcast_scalars = isnothing(broadcast_scalars) ? "" : string(broadcast_scalars)
+    # The C++ source of a kernel, built by `Kokkos.Views.compile_kernel`
+    kernel_source     = isnothing(kernel_source)     ? "" : string(kernel_source)
+
+    @debug "Parameters of $cmake_target:\n\t$(join([
         "view_layout = $view_layout",
         "view_dim = $view_dim",
         "view_type = $view_type",
         "exec_space = $exec_space",
         "mem_space = $mem_space",
+        "mem_traits = $mem_traits",
         "dest_layout = $dest_layout",
         "dest_space = $dest_space",
+        "dest_mem_traits = $dest_mem_traits",
         "without_exec_space_arg = $without_exec_space_arg",
         "with_nothing_arg = $with_nothing_arg",
-        "subview_dim = $subview_dim"
+        "subview_dim = $subview_dim",
+        "broadcast_expr = $broadcast_expr",
+        "broadcast_views = $broadcast_views",
+        "broadcast_scalars = $broadcast_scalars",
+        "kernel_source = $(isempty(kernel_source) ? "" : "<$(length(kernel_source)) chars>")"
     ], "\n\t"))"
 
-    # The lib name must uniquely identify a compilation with its parameters, in order to be able to
-    # reuse a previously compiled lib safely.
+    # The lib name must uniquely identify a compilation with its parameters and the configuration, in
+    # order to be able to reuse a previously compiled lib safely.
     lib_name = build_lib_name(
         cmake_target,
         view_layout, view_dim, view_type,
-        exec_space, mem_space,
-        dest_layout, dest_space,
+        exec_space, mem_space, mem_traits,
+        dest_layout, dest_space, dest_mem_traits,
         without_exec_space_arg, with_nothing_arg,
-        subview_dim
+        subview_dim,
+        broadcast_expr, broadcast_views, broadcast_scalars,
+        kernel_source
+    ) |> cached_lib_name
+
+    parameters = build_compilation_parameters(
+        view_layout, view_dim, view_type,
+        exec_space, mem_space, mem_traits,
+        dest_layout, dest_space, dest_mem_traits,
+        without_exec_space_arg, with_nothing_arg,
+        subview_dim,
+        broadcast_expr, broadcast_views, broadcast_scalars,
+        kernel_source
     )
 
+    return lib_name, parameters
+end
+
+
+"""
+    compile_and_load(current_module, cmake_target; kwargs...)
+
+Check if the library of `cmake_target` compiled with `kwargs` exists, if not compile it, then load
+it.
+
+The library is a CxxWrap module, which is then loaded into `current_module` in the sub-module
+`Impl<number>` with '<number>' the total count of calls to `compile_and_load` in this Julia session.
+This new module is returned.
+"""
+function compile_and_load(current_module, cmake_target; kwargs...)
+    lib_name, parameters = lib_name_and_parameters(cmake_target; kwargs...)
     lib_path = joinpath(Wrapper.get_kokkos_func_libs_dir(), lib_name)
 
     if !is_lib_up_to_date(lib_path)
-        parameters = build_compilation_parameters(
-            view_layout, view_dim, view_type,
-            exec_space, mem_space,
-            dest_layout, dest_space,
-            without_exec_space_arg, with_nothing_arg,
-            subview_dim
-        )
         @debug "Building '$cmake_target' in lib at '$lib_path'"
         compile_lib(cmake_target, lib_path, parameters)
     else
         @debug "Getting '$cmake_target' in lib from '$lib_path' (already compiled)"
+        mark_lib_as_used(lib_path)
     end
 
     register_new_functions(current_module, lib_path, lib_name)
 end
 
 
+"""
+    compile_batch(manifest)
+
+Compile all libraries described by `manifest`, a collection of `cmake_target => kwargs` pairs,
+where `kwargs` are the keyword arguments which would be passed to [`compile_and_load`](@ref) (as a
+`NamedTuple` or a `Dict{Symbol}`).
+
+All libraries which are not yet compiled are built in a single CMake build, each in its own
+directory with its own parameters, therefore they are compiled in parallel.
+
+Libraries are not loaded: subsequent calls to [`compile_and_load`](@ref) with the same parameters
+will only load them.
+
+```julia
+views_params = [(; view_type, view_dim, view_layout=Kokkos.LayoutRight, mem_space=Kokkos.HostSpace)
+                for view_type in (Float64, Int64), view_dim in 1:3]
+copy_params = [(; params..., dest_layout=Kokkos.LayoutLeft, dest_space=Kokkos.HostSpace,
+                without_exec_space_arg=true) for params in views_params]
+Kokkos.DynamicCompilation.compile_batch(vcat("views" .=> views_params, "copy" .=> copy_params))
+```
+"""
+function compile_batch(manifest)
+    ensure_kokkos_wrapper_loaded()
+    libs_dir = Wrapper.get_kokkos_func_libs_dir()
+
+    instances = Dict{String, Tuple{String, Dict{String, Any}}}()
+    for (cmake_target, kwargs) in manifest
+        lib_name, parameters = lib_name_and_parameters(cmake_target; kwargs...)
+        instances[lib_name] = (cmake_target, parameters)
+    end
+
+    filter!(instance -> !is_lib_up_to_date(joinpath(libs_dir, first(instance))), instances)
+    isempty(instances) && return
+
+    # The same locks as `compile_lib` for each library, always taken in the same order to avoid
+    # deadlocks, therefore no library is built at the same time by `compile_and_load`.
+    compilation_locks(sort!(collect(keys(instances)))) do
+        # Some libraries may have been compiled while waiting for the locks
+        filter!(instance -> !is_lib_up_to_date(joinpath(libs_dir, first(instance))), instances)
+        isempty(instances) && return
+
+        @debug "Building $(length(instances)) libs in a single batch"
+        compile_instances(instances)
+    end
+    evict_libs()
+
+    return nothing
+end
+
+
 """
     call_more_specific(func, args)
 
@@ -0,0 +1,236 @@
+# Kokkos kernels written in C++ from Julia, compiled in the 'kernel' library.
+# Included in the `Kokkos.Views` module.
+
+export KokkosKernel, compile_kernel, @kokkos_kernel
+
+
+"""
+    KokkosKernel
+
+A kernel compiled with [`compile_kernel`](@ref). Call it with the number of iterations and its
+arguments:
+
+    kernel(n, args...; exec_space=kernel.exec_space())
+
+which returns the result of the reduction, or `nothing` for a `parallel_for`.
+"""
+struct KokkosKernel
+    name::String
+    exec_space::Type{<:ExecutionSpace}
+    arg_names::Vector{Symbol}
+    arg_types::Vector{Type}
+    reduce::Union{Nothing, Type}
+    func::Any  # `kernel` of the loaded library
+end
+
+
+const _KERNEL_REDUCERS = Dict(:sum => "Kokkos::Sum", :prod => "Kokkos::Prod", :min => "Kokkos::Min", :max => "Kokkos::Max")
+
+# Loaded kernels, by source, execution space and memory space
+const _LOADED_KERNELS = Dict{Tuple{String, DataType, Any}, Any}()
+const _LOADED_KERNELS_LOCK = ReentrantLock()
+
+
+function _kernel_arg_type(name::Symbol, arg_t::Type)
+    if arg_t <: View
+        if !applicable(main_view_type, arg_t)
+            error("the type of the kernel argument `$name` must be a complete view type, with a \
+                   layout and a memory space, got: $arg_t")
+        end
+        return main_view_type(arg_t)
+    elseif arg_t <: Union{Base.BitInteger64, Float32, Float64, Bool}
+        return arg_t
+    else
+        error("kernel arguments must be views or scalars, got `$name::$arg_t`")
+    end
+end
+
+
+function _kernel_cxx_view_type(view_t::Type{<:View})
+    view_type, view_dim, view_layout, _, mem_traits = _extract_view_params(view_t)
+    return "ViewWrap<$(Wrapper.julia_type_to_c(view_type)), std::integral_constant<int, $view_dim>, \
+            Kokkos::$(nameof(view_layout)), MemorySpace, Kokkos::MemoryTraits<$(memory_traits_flags(mem_traits))>>"
+end
+
+
+function _kernel_source(name, body, arg_names, arg_types, reduce, reducer)
+    source = IOBuffer()
+    println(source, "// Kernel '$name', generated by `Kokkos.Views.compile_kernel`\n")
+    println(source, "#define KERNEL_LABEL \"Kokkos.jl::kernel::$name\"")
+    println(source, "#define KERNEL_IS_REDUCTION ", Int(!isnothing(reduce)))
+    if !isnothing(reduce)
+        println(source, "#define KERNEL_REDUCER ", _KERNEL_REDUCERS[reducer])
+        println(source, "using KernelResult = ", Wrapper.julia_type_to_c(reduce), ";")
+    end
+    println(source)
+
+    params = String[]
+    for (i, arg_t) in enumerate(arg_types)
+        if arg_t <: View
+            println(source, "using KernelArg$i = ", _kernel_cxx_view_type(arg_t), ";")
+            push!(params, "const KernelArg$i&")
+        else
+            push!(params, Wrapper.julia_type_to_c(arg_t))
+        end
+    end
+    println(source, "using KernelParams = TList<", join(params, ", "), ">;\n")
+
+    println(source, "struct Kernel {")
+    for (i, (arg_name, arg_t)) in enumerate(zip(arg_names, arg_types))
+        field_type = arg_t <: View ? "typename KernelArg$i::kokkos_view_t" : Wrapper.julia_type_to_c(arg_t)
+        println(source, "    $field_type $arg_name;")
+    end
+    println(source)
+    if isnothing(reduce)
+        println(source, "    KOKKOS_INLINE_FUNCTION void operator()(const int64_t i) const")
+    else
+        println(source, "    KOKKOS_INLINE_FUNCTION void operator()(const int64_t i, KernelResult& result) const")
+    end
+    println(source, "    {")
+    println(source, "#line 1 \"$name\"")  # Compilation errors refer to the lines of `body`
+    println(source, body)
+    println(source, "    }")
+    println(source, "};")
+    return String(take!(source))
+end
+
+
+"""
+    compile_kernel(name, body, args; reduce=nothing, reducer=:sum, exec_space=nothing)
+
+Compile the C++ `body` into a Kokkos kernel named `name`, and return it as a [`KokkosKernel`](@ref).
+
+`args` is a list of `name => type` pairs: the arguments of the kernel, usable by name in `body`.
+Views are passed as `Kokkos::View` (their type must be complete, with a layout and a memory space),
+and scalars (integers of 64 bits or less, `Float32`, `Float64` or `Bool`) by value.
+
+`body` is the body of a `Kokkos::parallel_for` over `int64_t i` from `0` to `n - 1`. If `reduce` is
+a scalar type, it is the body of a `Kokkos::parallel_reduce` instead, accumulating into
+`reduce& result` with the `reducer` (`:sum`, `:prod`, `:min` or `:max`), and the result of the
+reduction is returned when calling the kernel.
+
+The kernel runs on instances of `exec_space`, which defaults to the execution space of the memory
+space of the first view argument, or [`DEFAULT_DEVICE_SPACE`](@ref) if there is none.
+All views must be in the same memory space, accessible from `exec_space`.
+
+Kernels are compiled through the same pipeline and cache as the other dynamically compiled libraries,
+therefore the same kernel is compiled only once. Kernels already loaded in the current session are
+reused as is.
+
+```julia
+V = View{Float64, 1, Kokkos.LayoutRight, Kokkos.HostSpace}
+axpy = Kokkos.compile_kernel("axpy", "y(i) += alpha * x(i);", [:y => V, :x => V, :alpha => Float64])
+axpy(length(y), y, x, 2.0)
+
+dot = Kokkos.compile_kernel("dot", "result += x(i) * y(i);", [:x => V, :y => V]; reduce=Float64)
+dot(length(x), x, y)
+```
+
+See also [`@kokkos_kernel`](@ref).
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function compile_kernel(name::AbstractString, body::AbstractString, args;
+    reduce = nothing, reducer = :sum, exec_space = nothing
+)
+    if !isnothing(match(r"[^\w.]", name))
+        error("kernel names can only contain letters, digits, '_' and '.', got: '$name'")
+    end
+    !isnothing(reduce) && !haskey(_KERNEL_REDUCERS, reducer) &&
+        error("unknown reducer: $reducer, expected one of: $(join(keys(_KERNEL_REDUCERS), ", "))")
+
+    arg_names = Symbol[first(arg) for arg in args]
+    arg_types = Type[_kernel_arg_type(first(arg), last(arg)) for arg in args]
+    allunique(arg_names) || error("kernel arguments must have different names, got: $arg_names")
+
+    view_types = filter(t -> t <: View, arg_types)
+    mem_spaces = unique(memory_space.(view_types))
+    length(mem_spaces) > 1 && error("all view arguments of a kernel must be in the same memory space, \
+                                     got: $(join(mem_spaces, ", "))")
+    mem_space = isempty(mem_spaces) ? nothing : only(mem_spaces)
+
+    if isnothing(exec_space)
+        exec_space = isnothing(mem_space) ? DEFAULT_DEVICE_SPACE : execution_space(mem_space)
+    end
+    exec_space = main_space_type(exec_space)
+
+    foreach(view_t -> compile_view(view_t; for_function=compile_kernel, no_error=true), view_types)
+
+    kernel_source = _kernel_source(name, body, arg_names, arg_types, reduce, reducer)
+    key = (kernel_source, exec_space, mem_space)
+    kernel_func = lock(() -> get(_LOADED_KERNELS, key, nothing), _LOADED_KERNELS_LOCK)
+    if isnothing(kernel_func)
+        # Compilation is already protected by `DynamicCompilation.compilation_lock`
+        impl_module = DynamicCompilation.compile_and_load(@__MODULE__, "kernel";
+            exec_space, mem_space, kernel_source
+        )
+        kernel_func = lock(() -> get!(_LOADED_KERNELS, key, impl_module.kernel), _LOADED_KERNELS_LOCK)
+    end
+    return KokkosKernel(name, exec_space, arg_names, arg_types, reduce, kernel_func)
+end
+
+
+function (kernel::KokkosKernel)(n::Integer, args...; exec_space=kernel.exec_space())
+    if length(args) != length(kernel.arg_types)
+        error("kernel '$(kernel.name)' expects $(length(kernel.arg_types)) arguments \
+               ($(join(kernel.arg_names, ", "))), got $(length(args))")
+    end
+    if !(exec_space isa kernel.exec_space)
+        error("kernel '$(kernel.name)' was compiled for `$(kernel.exec_space)`, got: $(typeof(exec_space))")
+    end
+    call_args = map(args, kernel.arg_types, kernel.arg_names) do arg, arg_t, arg_name
+        if arg_t <: View
+            if !(arg isa View) || main_view_type(arg) !== arg_t
+                error("expected the argument `$arg_name` of kernel '$(kernel.name)' to be a `$arg_t`, \
+                       got: $(typeof(arg))")
+            end
+            return arg
+        else
+            return convert(arg_t, arg)
+        end
+    end
+    result = Base.invokelatest(kernel.func, exec_space, Int64(n), call_args...)
+    return isnothing(kernel.reduce) ? nothing : result
+end
+
+
+function Base.show(io::IO, kernel::KokkosKernel)
+    args = join(("$name::$t" for (name, t) in zip(kernel.arg_names, kernel.arg_types)), ", ")
+    print(io, "KokkosKernel '", kernel.name, "'(", args, ") on ", nameof(kernel.exec_space))
+    !isnothing(kernel.reduce) && print(io, " -> ", kernel.reduce)
+end
+
+
+"""
+    @kokkos_kernel name(args...) body [reduce=T] [reducer=:sum] [exec_space=S]
+
+Macro version of [`compile_kernel`](@ref): each argument of `args` is written as `name::Type`, and
+`body` is a string of C++ code.
+
+```julia
+V = View{Float64, 1, Kokkos.LayoutRight, Kokkos.HostSpace}
+axpy = @kokkos_kernel axpy(y::V, x::V, alpha::Float64) \"\"\"
+    y(i) += alpha * x(i);
+\"\"\"
+axpy(length(y), y, x, 2.0)
+```
+"""
+macro kokkos_kernel(call, body, options...)
+    if !Meta.isexpr(call, :call) || !(call.args[1] isa Symbol)
+        error("expected a kernel signature: `name(args...)`, got: $call")
+    end
+    name = string(call.args[1])
+    args = map(call.args[2:end]) do arg
+        if !Meta.isexpr(arg, :(::), 2) || !(arg.args[1] isa Symbol)
+            error("expected a kernel argument as `name::Type`, got: $arg")
+        end
+        return :($(QuoteNode(arg.args[1])) => $(esc(arg.args[2])))
+    end
+    kwargs = map(options) do option
+        if !Meta.isexpr(option, :(=), 2)
+            error("expected a kernel option as `name=value`, got: $option")
+        end
+        return Expr(:kw, option.args[1], esc(option.args[2]))
+    end
+    return :($compile_kernel($name, $(esc(body)), [$(args...)]; $(kwargs...)))
+end
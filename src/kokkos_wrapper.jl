@@ -11,7 +11,7 @@ import ..Kokkos: ensure_kokkos_wrapper_loaded, configuration_changed!
 import ..Kokkos: to_kokkos_version_string, __change_local_version
 import ..Kokkos: LOCAL_KOKKOS_DIR, LOCAL_KOKKOS_VERSION_STR
 import ..Kokkos: KOKKOS_PATH, KOKKOS_CMAKE_OPTIONS, KOKKOS_LIB_OPTIONS, KOKKOS_BACKENDS
-import ..Kokkos: KOKKOS_BUILD_TYPE, KOKKOS_BUILD_DIR
+import ..Kokkos: KOKKOS_BUILD_TYPE, KOKKOS_BUILD_DIR, KOKKOS_LIBS_CACHE_DIR
 
 export get_jlcxx_root, get_kokkos_dir, get_kokkos_build_dir, get_kokkos_install_dir
 export load_wrapper_lib, get_impl_module
@@ -224,7 +224,7 @@ function compile_wrapper_lib(; no_compilation=false, no_git=false, loading_bar=t
 
     pretty_compile(KOKKOS_LIB_PROJECT; info=true, loading_bar)
     install_kokkos()
-    mkpath(joinpath(build_dir(KOKKOS_LIB_PROJECT), "func_libs"))
+    mkpath(func_libs_dir())
     clear_compilation_lock()
 end
 
@@ -259,9 +259,18 @@ function get_kokkos_install_dir()
 end
 
 
+func_libs_dir() = @something KOKKOS_LIBS_CACHE_DIR joinpath(build_dir(KOKKOS_LIB_PROJECT), "func_libs")
+
+
+"""
+    get_kokkos_func_libs_dir()
+
+The directory where dynamically compiled libraries are stored: the [libs_cache_dir](@ref) if set,
+otherwise in the build directory of the wrapper library.
+"""
 function get_kokkos_func_libs_dir()
     ensure_kokkos_wrapper_loaded()
-    return joinpath(build_dir(KOKKOS_LIB_PROJECT), "func_libs")
+    return func_libs_dir()
 end
 
 
@@ -289,6 +298,7 @@ get_impl_module() = Impl
     load_wrapper_lib(; no_compilation=false, no_git=false, loading_bar=true)
 
 Configures, compiles then loads the wrapper library using the current [Configuration Options](@ref).
+Views of the [prebuilt_views](@ref) option are then compiled and registered (see [`prebuild_views`](@ref)).
 
 After calling this method, all configuration options become locked.
 
@@ -329,6 +339,7 @@ function load_wrapper_lib(; no_compilation=false, no_git=false, loading_bar=true
     Kokkos = parentmodule(Wrapper)
     Kokkos.__init_vars()
     Kokkos.__init_spaces_vars()
+    Kokkos.Views.__init_prebuilt_views(; no_compilation)
 
     return
 end
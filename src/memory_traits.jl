@@ -0,0 +1,70 @@
+"""
+    MemoryTraits{Flags}
+
+Memory access traits of a [`View`](@ref). `Flags` is an `Int` combination of the following flags:
+ - [`Unmanaged`](@ref): the view does not own its data, there is no reference counting nor
+   deallocation. Such views can only be created with [`view_wrap`](@ref).
+ - [`RandomAccess`](@ref): hints for non-contiguous and read-only accesses, allowing the use of
+   texture memory for some GPU backends.
+ - [`Atomic`](@ref): all accesses to the elements of the view are atomic.
+ - [`Restrict`](@ref): the view data is not aliased by any other view, equivalent to `__restrict__`.
+
+`MemoryTraits{0}` is the default, and the most common, memory traits. `Flags` must be an `Int`:
+`MemoryTraits{0x3}` is a different type than `MemoryTraits{3}`, and only the latter is valid.
+
+Equivalent to [`Kokkos::MemoryTraits<Flags>`](https://kokkos.github.io/kokkos-core-wiki/API/core/view/view.html#memorytraits).
+
+```julia
+# An unmanaged view with random access
+View{Float64, 1, Kokkos.LayoutRight, Kokkos.HostSpace, Kokkos.MemoryTraits{Kokkos.Unmanaged | Kokkos.RandomAccess}}
+```
+"""
+struct MemoryTraits{Flags} end
+
+
+"""
+    Unmanaged
+
+Memory traits flag, equivalent to `Kokkos::Unmanaged`. See [`MemoryTraits`](@ref).
+"""
+const Unmanaged = 1
+
+
+"""
+    RandomAccess
+
+Memory traits flag, equivalent to `Kokkos::RandomAccess`. See [`MemoryTraits`](@ref).
+"""
+const RandomAccess = 2
+
+
+"""
+    Atomic
+
+Memory traits flag, equivalent to `Kokkos::Atomic`. See [`MemoryTraits`](@ref).
+"""
+const Atomic = 4
+
+
+"""
+    Restrict
+
+Memory traits flag, equivalent to `Kokkos::Restrict`. See [`MemoryTraits`](@ref).
+"""
+const Restrict = 8
+
+
+memory_traits_flags(::Type{MemoryTraits{Flags}}) where {Flags} = Flags::Int
+
+
+"""
+    has_memory_trait(::Type{<:MemoryTraits}, flag)
+
+Return `true` if the memory traits type contains `flag`.
+
+```julia-repl
+julia> Kokkos.has_memory_trait(Kokkos.MemoryTraits{Kokkos.Unmanaged | Kokkos.Atomic}, Kokkos.Atomic)
+true
+```
+"""
+has_memory_trait(traits::Type{<:MemoryTraits}, flag) = (memory_traits_flags(traits) & flag) != 0
@@ -0,0 +1,382 @@
+# Profiling through Kokkos Tools callbacks, defined in 'profiling.cpp'
+
+export @kokkos_region
+
+
+# Same order as `EventKind` in 'profiling.cpp'
+const _PROFILE_EVENT_KINDS = (:parallel_for, :parallel_reduce, :parallel_scan, :deep_copy, :fence)
+
+
+"""
+    enable_kernel_profiler()
+
+Install the Kokkos Tools callbacks of the kernel profiler of `Kokkos.jl`, which measures the
+duration of all `Kokkos::parallel_for`, `Kokkos::parallel_reduce`, `Kokkos::parallel_scan`,
+`Kokkos::deep_copy` and fences, including those of other Kokkos libraries loaded in the process.
+Durations are aggregated by label: see [`kernel_profile`](@ref).
+
+The callbacks of a tool loaded with the `tools_libs` option of [`initialize`](@ref) are still
+called.
+
+Kokkos must be initialized.
+
+!!! note
+
+    As for any Kokkos tool, Kokkos fences after each kernel while the profiler is enabled, to
+    measure their true duration. This can slow down applications relying on asynchronous kernels.
+
+!!! note
+
+    Events are recorded in a buffer local to each thread, and their durations are added to the
+    stats of their thread without any lock. [`kernel_profile`](@ref) reads the stats while threads
+    update them: an event ending at the same time may be missing from the snapshot, or only be
+    partially counted. After [`reset_kernel_profile`](@ref), each thread clears its stats on its
+    next event.
+
+Events which began before the profiler was enabled, or ended after it was disabled, are ignored.
+"""
+function enable_kernel_profiler()
+    ensure_kokkos_wrapper_loaded()
+    Base.invokelatest(get_impl_module().__enable_kernel_profiler)
+    _update_tools_loaded()
+    return
+end
+
+
+"""
+    disable_kernel_profiler()
+
+Remove the callbacks installed by [`enable_kernel_profiler`](@ref). Measurements are kept until
+[`reset_kernel_profile`](@ref) is called.
+"""
+function disable_kernel_profiler()
+    ensure_kokkos_wrapper_loaded()
+    Base.invokelatest(get_impl_module().__disable_kernel_profiler)
+    _update_tools_loaded()
+    return
+end
+
+
+"""
+    kernel_profiler_enabled()
+
+Return `true` if the kernel profiler is enabled.
+"""
+function kernel_profiler_enabled()
+    !is_kokkos_wrapper_loaded() && return false
+    return Base.invokelatest(get_impl_module().__kernel_profiler_enabled)
+end
+
+
+"""
+    kernel_profile()
+
+Return the measurements of the kernel profiler (see [`enable_kernel_profiler`](@ref)), as a
+`Vector` of `NamedTuple`s (a row table compatible with `Tables.jl`), with the fields:
+ - `kind`: `:parallel_for`, `:parallel_reduce`, `:parallel_scan`, `:deep_copy` or `:fence`
+ - `label`: the label of the kernel or fence, or `"<destination label> <- <source label>"` for
+   deep copies
+ - `count`: the number of calls
+ - `total`, `min`, `max`, `mean`: durations of the calls, in seconds
+
+Rows are sorted by decreasing total duration.
+
+```julia
+Kokkos.enable_kernel_profiler()
+run_simulation()
+Kokkos.disable_kernel_profiler()
+for row in Kokkos.kernel_profile()
+    @printf("%-40s %8d %10.3f ms\\n", row.label, row.count, row.total * 1e3)
+end
+```
+"""
+function kernel_profile()
+    ensure_kokkos_wrapper_loaded()
+    kinds, labels, counts, totals, mins, maxs = Base.invokelatest(get_impl_module().__kernel_profile)
+    profile = map(zip(kinds, labels, counts, totals, mins, maxs)) do (kind, label, count, total, min, max)
+        return (;
+            kind = _PROFILE_EVENT_KINDS[kind + 1],
+            label = String(label),
+            count = Int(count),
+            total = total / 1e9, min = min / 1e9, max = max / 1e9,
+            mean = total / count / 1e9
+        )
+    end
+    return sort!(profile; by=row -> row.total, rev=true)
+end
+
+
+"""
+    reset_kernel_profile()
+
+Clear all measurements of the kernel profiler.
+"""
+function reset_kernel_profile()
+    ensure_kokkos_wrapper_loaded()
+    Base.invokelatest(get_impl_module().__reset_kernel_profile)
+    return
+end
+
+
+# Defined in 'kokkos_wrapper.cpp', in 'define_profiling_regions'
+"""
+    profile_library_loaded()
+
+Return `true` if any Kokkos Tools callbacks are installed: either from a tool loaded with the
+`tools_libs` option of [`initialize`](@ref), or by [`enable_kernel_profiler`](@ref).
+
+Equivalent to `Kokkos::Profiling::profileLibraryLoaded()`.
+"""
+function profile_library_loaded end
+
+
+# Defined in 'kokkos_wrapper.cpp', in 'define_profiling_regions'
+"""
+    push_region(name::String)
+
+Start a new profiling region `name`, nested in the current one.
+
+Equivalent to `Kokkos::Profiling::pushRegion(name)`.
+
+See also [`@kokkos_region`](@ref).
+"""
+function push_region end
+
+
+# Defined in 'kokkos_wrapper.cpp', in 'define_profiling_regions'
+"""
+    pop_region()
+
+End the current profiling region.
+
+Equivalent to `Kokkos::Profiling::popRegion()`.
+"""
+function pop_region end
+
+
+# Defined in 'kokkos_wrapper.cpp', in 'define_profiling_regions'
+"""
+    mark_event(name::String)
+
+Signal the event `name` to the loaded tool.
+
+Equivalent to `Kokkos::Profiling::markEvent(name)`.
+"""
+function mark_event end
+
+
+# Defined in 'kokkos_wrapper.cpp', in 'define_profiling_regions'
+"""
+    create_profile_section(name::String)::UInt32
+
+Create a profiling section `name` and return its ID. Unlike regions, a section can be started and
+stopped many times, and sections do not need to be nested.
+
+Equivalent to `Kokkos::Profiling::createProfileSection(name, &section_id)`.
+"""
+function create_profile_section end
+
+
+# Defined in 'kokkos_wrapper.cpp', in 'define_profiling_regions'
+"""
+    start_section(section_id::UInt32)
+
+Equivalent to `Kokkos::Profiling::startSection(section_id)`.
+"""
+function start_section end
+
+
+# Defined in 'kokkos_wrapper.cpp', in 'define_profiling_regions'
+"""
+    stop_section(section_id::UInt32)
+
+Equivalent to `Kokkos::Profiling::stopSection(section_id)`.
+"""
+function stop_section end
+
+
+# Defined in 'kokkos_wrapper.cpp', in 'define_profiling_regions'
+"""
+    destroy_profile_section(section_id::UInt32)
+
+Equivalent to `Kokkos::Profiling::destroyProfileSection(section_id)`.
+"""
+function destroy_profile_section end
+
+
+# Result of `profile_library_loaded()`, updated after `Kokkos.initialize` and when callbacks are
+# installed or removed by `Kokkos.jl`
+const _TOOLS_LOADED = Ref(false)
+
+
+function _update_tools_loaded()
+    _TOOLS_LOADED[] = is_initialized() && !is_finalized() &&
+        Base.invokelatest(profile_library_loaded)
+end
+
+
+"""
+    @kokkos_region name expr
+
+Evaluate `expr` in the profiling region `name` (see [`push_region`](@ref)), and return its value.
+The region is ended even if `expr` throws an exception.
+
+Whether a tool is loaded is checked once: after [`initialize`](@ref), and when the callbacks of
+`Kokkos.jl` are installed or removed (e.g. with [`enable_kernel_profiler`](@ref)). Otherwise,
+`expr` is evaluated as is, at the cost of a single branch.
+
+```julia
+@kokkos_region "update_halos" begin
+    update_halos!(domain)
+end
+```
+"""
+macro kokkos_region(name, expr)
+    return quote
+        if $_TOOLS_LOADED[]
+            $push_region($(esc(name)))
+            try
+                $(esc(expr))
+            finally
+                $pop_region()
+            end
+        else
+            $(esc(expr))
+        end
+    end
+end
+
+
+"""
+    enable_memory_telemetry()
+
+Install the Kokkos Tools callbacks of the memory telemetry of `Kokkos.jl`, which keeps track of
+all allocations in all memory spaces, including those of other Kokkos libraries loaded in the
+process. The current state is returned by [`memory_telemetry`](@ref).
+
+Only allocations made while the telemetry is enabled are tracked.
+The callbacks of a tool loaded with the `tools_libs` option of [`initialize`](@ref) are still
+called.
+
+Kokkos must be initialized.
+
+!!! note
+
+    As for any Kokkos tool, Kokkos fences after each kernel while the telemetry is enabled.
+"""
+function enable_memory_telemetry()
+    ensure_kokkos_wrapper_loaded()
+    Base.invokelatest(get_impl_module().__enable_memory_telemetry)
+    _update_tools_loaded()
+    return
+end
+
+
+"""
+    disable_memory_telemetry()
+
+Remove the callbacks installed by [`enable_memory_telemetry`](@ref). The counters are no longer
+updated until the telemetry is enabled again.
+"""
+function disable_memory_telemetry()
+    ensure_kokkos_wrapper_loaded()
+    Base.invokelatest(get_impl_module().__disable_memory_telemetry)
+    _update_tools_loaded()
+    return
+end
+
+
+"""
+    memory_telemetry_enabled()
+
+Return `true` if the memory telemetry is enabled.
+"""
+function memory_telemetry_enabled()
+    !is_kokkos_wrapper_loaded() && return false
+    return Base.invokelatest(get_impl_module().__memory_telemetry_enabled)
+end
+
+
+"""
+    host_memory_info()
+
+Return `(rss, free_memory, total_memory)`, in bytes: the resident set size of the process, and the
+available and total memory of the system.
+
+The RSS is only available on Linux, and is `0` otherwise.
+
+Host equivalent of [`BackendFunctions.memory_info`](@ref).
+"""
+function host_memory_info()
+    ensure_kokkos_wrapper_loaded()
+    return Base.invokelatest(get_impl_module().__host_memory_info)
+end
+
+
+"""
+    memory_telemetry()
+
+A snapshot of the memory tracked by the memory telemetry (see [`enable_memory_telemetry`](@ref)),
+as a `NamedTuple` with the fields:
+ - `spaces`: a `Vector` of `NamedTuple`s, one for each enabled memory space, with the fields:
+   - `space`: the memory space type (e.g. `Kokkos.HostSpace`)
+   - `live_bytes`: the memory currently allocated in the space
+   - `high_water_bytes`: the maximum of `live_bytes` (see [`reset_memory_high_water`](@ref))
+   - `allocations`, `deallocations`: the number of allocations and deallocations
+   - `labels`: a `Vector` of `(label, live_bytes, live_allocations)` for each label with live
+     allocations in the space, sorted by decreasing `live_bytes`
+ - `host`: the result of [`host_memory_info`](@ref), as `(rss, free, total)`
+ - `device`: the result of [`BackendFunctions.memory_info`](@ref) as `(free, total)` for CUDA and
+   HIP, `nothing` for other backends
+
+```julia
+Kokkos.enable_memory_telemetry()
+run_simulation()
+for space in Kokkos.memory_telemetry().spaces
+    println(space.space, ": ", Base.format_bytes(space.high_water_bytes))
+    for label in first(space.labels, 5)
+        println("  ", label.label, ": ", Base.format_bytes(label.live_bytes))
+    end
+end
+```
+"""
+function memory_telemetry()
+    ensure_kokkos_wrapper_loaded()
+    names, live, high_water, allocations, deallocations,
+        label_spaces, labels, label_live, label_allocations =
+            Base.invokelatest(get_impl_module().__memory_telemetry)
+
+    space_types = Dict(String(kokkos_name(space)) => space for space in ENABLED_MEM_SPACES)
+    spaces = map(enumerate(names)) do (i, name)
+        space_labels = [
+            (; label = String(labels[j]), live_bytes = Int(label_live[j]), live_allocations = Int(label_allocations[j]))
+            for j in eachindex(labels) if label_spaces[j] == i - 1
+        ]
+        sort!(space_labels; by=label -> label.live_bytes, rev=true)
+        return (;
+            space = space_types[String(name)],
+            live_bytes = Int(live[i]), high_water_bytes = Int(high_water[i]),
+            allocations = Int(allocations[i]), deallocations = Int(deallocations[i]),
+            labels = space_labels
+        )
+    end
+
+    host = NamedTuple{(:rss, :free, :total)}(Int.(host_memory_info()))
+    memory_info = BackendFunctions.memory_info
+    device = hasmethod(memory_info, Tuple{}) ?
+        NamedTuple{(:free, :total)}(Int.(Base.invokelatest(memory_info))) : nothing
+
+    return (; spaces, host, device)
+end
+
+
+"""
+    reset_memory_high_water()
+
+Set the `high_water_bytes` of all memory spaces to their current `live_bytes`.
+"""
+function reset_memory_high_water()
+    ensure_kokkos_wrapper_loaded()
+    Base.invokelatest(get_impl_module().__reset_memory_high_water)
+    return
+end
@@ -0,0 +1,203 @@
+# Reductions of views with `Kokkos::parallel_reduce`, compiled in the 'reductions' library.
+# Included in the `Kokkos.Views` module.
+
+import LinearAlgebra
+
+
+# Must match `ReductionOp` in 'reductions.cpp'
+const REDUCE_SUM     = Int32(0)
+const REDUCE_PROD    = Int32(1)
+const REDUCE_MIN     = Int32(2)
+const REDUCE_MAX     = Int32(3)
+const REDUCE_ABS_SUM = Int32(4)
+const REDUCE_SQ_SUM  = Int32(5)
+const REDUCE_ABS_MAX = Int32(6)
+
+
+# Element types for which reductions are done natively
+const NativeReductionTypes = Union{Base.BitInteger64, Float32, Float64}
+
+
+# The element type of the result of `sum` and `prod` must not be promoted (e.g. from `Int32` to `Int64`)
+_has_native_sum(::Type{T}) where {T} = T <: NativeReductionTypes && Base.promote_op(Base.add_sum, T, T) === T
+_has_native_prod(::Type{T}) where {T} = T <: NativeReductionTypes && Base.promote_op(Base.mul_prod, T, T) === T
+
+_is_native_dims(v::View, dims) = dims isa Colon || (dims isa Integer && 1 ≤ dims ≤ ndims(v))
+
+
+# Type of the view returned by a reduction along one dimension. Must match `DestView` in 'reductions.cpp'.
+function _reduce_dims_view_type(view_t::Type{<:View})
+    view_type, view_dim, view_layout, mem_space, _ = _extract_view_params(view_t)
+    dest_layout = view_layout === LayoutStride ? LayoutLeft : view_layout
+    return View{view_type, view_dim, dest_layout, mem_space}
+end
+
+
+function compile_reductions(exec_space::ExecutionSpace, view_t::Type{<:View})
+    @nospecialize exec_space view_t
+    compile_view(view_t; for_function=_reduce, no_error=true)
+    compile_view(_reduce_dims_view_type(view_t); for_function=_reduce_dims, no_error=true)
+
+    view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(view_t)
+    DynamicCompilation.compile_and_load(@__MODULE__, "reductions";
+        view_type, view_dim, view_layout, mem_space, mem_traits,
+        exec_space=typeof(exec_space)
+    )
+end
+
+
+function _reduce(exec_space::ExecutionSpace, v::View, op::Int32)
+    @nospecialize exec_space v op
+    return DynamicCompilation.@compile_and_call(_reduce, (exec_space, v, op),
+        compile_reductions(exec_space, typeof(v))
+    )
+end
+
+
+function _reduce_minmax(exec_space::ExecutionSpace, v::View)
+    @nospecialize exec_space v
+    return DynamicCompilation.@compile_and_call(_reduce_minmax, (exec_space, v),
+        compile_reductions(exec_space, typeof(v))
+    )
+end
+
+
+function _reduce_dot(exec_space::ExecutionSpace, a::View, b::View)
+    @nospecialize exec_space a b
+    return DynamicCompilation.@compile_and_call(_reduce_dot, (exec_space, a, b), begin
+        if typeof(a) !== typeof(b)
+            error("`dot` is only done natively for views of the same type, got: \
+                   `$(main_view_type(a))` and `$(main_view_type(b))`")
+        end
+        compile_reductions(exec_space, typeof(a))
+    end)
+end
+
+
+function _reduce_dims(exec_space::ExecutionSpace, dest::View, src::View, dim::Int64, op::Int32)
+    @nospecialize exec_space dest src dim op
+    return DynamicCompilation.@compile_and_call(_reduce_dims, (exec_space, dest, src, dim, op),
+        compile_reductions(exec_space, typeof(src))
+    )
+end
+
+
+function _view_reduce(v::View, op::Int32, dims, exec_space)
+    exec_space = something(exec_space, _default_exec_space(v))
+    dims isa Colon && return _reduce(exec_space, v, op)
+
+    dest_t = _reduce_dims_view_type(typeof(v))
+    dest = dest_t(undef, ntuple(d -> d == dims ? 1 : size(v, d), ndims(v)))
+    _reduce_dims(exec_space, dest, v, Int64(dims - 1), op)
+    return dest
+end
+
+
+"""
+    sum(v::View; dims=:, exec_space=nothing)
+    prod(v::View; dims=:, exec_space=nothing)
+    minimum(v::View; dims=:, exec_space=nothing)
+    maximum(v::View; dims=:, exec_space=nothing)
+    extrema(v::View; exec_space=nothing)
+
+Reductions over all elements of `v` (or along a single dimension `dims`) with a
+`Kokkos::parallel_reduce` on `exec_space`, which defaults to the [`execution_space`](@ref) of the
+memory space of `v`. This works for views which are not accessible from the host.
+
+When `dims` is given, the result is a new [`View`](@ref) in the same memory space as `v`, with the
+same layout (or [`LayoutLeft`](@ref) if `v` uses a [`LayoutStride`](@ref)), and with a size of 1
+along `dims`.
+
+Only views of `Float32`, `Float64` or integers of 64 bits or less are reduced natively, and only if
+the result type is the same as the element type (e.g. `sum` of a view of `Int32` is promoted to
+`Int64` by Julia). Other cases fall back to the generic `AbstractArray` methods.
+
+`LinearAlgebra.dot` of two views of the same type and `LinearAlgebra.norm` of views of floats (with
+`p` equal to 1, 2 or `Inf`) are also done natively.
+
+Equivalent to `Kokkos::parallel_reduce` with the `Kokkos::Sum`, `Kokkos::Prod`, `Kokkos::Min`,
+`Kokkos::Max` and `Kokkos::MinMax` reducers.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.sum(v::View{T}; dims=:, exec_space=nothing, kwargs...) where {T}
+    if !isempty(kwargs) || !_has_native_sum(T) || !_is_native_dims(v, dims)
+        return invoke(sum, Tuple{AbstractArray}, v; dims, kwargs...)
+    end
+    return _view_reduce(v, REDUCE_SUM, dims, exec_space)
+end
+
+
+function Base.prod(v::View{T}; dims=:, exec_space=nothing, kwargs...) where {T}
+    if !isempty(kwargs) || !_has_native_prod(T) || !_is_native_dims(v, dims)
+        return invoke(prod, Tuple{AbstractArray}, v; dims, kwargs...)
+    end
+    return _view_reduce(v, REDUCE_PROD, dims, exec_space)
+end
+
+
+# Empty reductions are an error for `minimum`, `maximum` and `extrema`, the generic methods handle it
+function Base.minimum(v::View{T}; dims=:, exec_space=nothing, kwargs...) where {T}
+    if !isempty(kwargs) || !(T <: NativeReductionTypes) || !_is_native_dims(v, dims) || isempty(v)
+        return invoke(minimum, Tuple{AbstractArray}, v; dims, kwargs...)
+    end
+    return _view_reduce(v, REDUCE_MIN, dims, exec_space)
+end
+
+
+function Base.maximum(v::View{T}; dims=:, exec_space=nothing, kwargs...) where {T}
+    if !isempty(kwargs) || !(T <: NativeReductionTypes) || !_is_native_dims(v, dims) || isempty(v)
+        return invoke(maximum, Tuple{AbstractArray}, v; dims, kwargs...)
+    end
+    return _view_reduce(v, REDUCE_MAX, dims, exec_space)
+end
+
+
+function Base.extrema(v::View{T}; exec_space=nothing, kwargs...) where {T}
+    if !isempty(kwargs) || !(T <: NativeReductionTypes) || isempty(v)
+        return invoke(extrema, Tuple{AbstractArray}, v; kwargs...)
+    end
+    return _reduce_minmax(something(exec_space, _default_exec_space(v)), v)
+end
+
+
+function LinearAlgebra.dot(a::V, b::V) where {V <: View{<:NativeReductionTypes}}
+    if size(a) != size(b)
+        throw(DimensionMismatch("first view has size $(size(a)) which does not match the size of the second, $(size(b))"))
+    end
+    return _reduce_dot(_default_exec_space(a), a, b)
+end
+
+
+function LinearAlgebra.norm(v::View{T}, p::Real=2) where {T <: Union{Float32, Float64}}
+    isempty(v) && return zero(T)
+    exec_space = _default_exec_space(v)
+    if p == 2
+        sq_sum = _reduce(exec_space, v, REDUCE_SQ_SUM)
+        isfinite(sq_sum) && sq_sum ≥ floatmin(T) && return sqrt(sq_sum)
+        # The sum of squares overflowed or (possibly) underflowed: the generic method scales by the
+        # maximum absolute value, like `LinearAlgebra.generic_norm2`.
+        max_abs = _reduce(exec_space, v, REDUCE_ABS_MAX)
+        (iszero(max_abs) || !isfinite(max_abs)) && return max_abs
+        return _generic_norm(v, p)
+    elseif p == 1
+        return _reduce(exec_space, v, REDUCE_ABS_SUM)
+    elseif p == Inf
+        return _reduce(exec_space, v, REDUCE_ABS_MAX)
+    else
+        return _generic_norm(v, p)
+    end
+end
+
+
+# The generic `norm` indexes `v` element by element: views not accessible from the host are copied
+# to a host mirror first.
+function _generic_norm(v::View, p::Real)
+    mirror = create_mirror_view(v; track=false)
+    mirror !== v && deep_copy(mirror, v)
+    try
+        return invoke(LinearAlgebra.norm, Tuple{AbstractArray, Real}, mirror, p)
+    finally
+        mirror !== v && finalize(mirror)
+    end
+end
@@ -0,0 +1,164 @@
+# Sorting of 1D views with `Kokkos::sort` and `Kokkos::BinSort`, compiled in the 'sort' library.
+# Included in the `Kokkos.Views` module.
+
+export bin_sort, bin_sort!, sort_by_key!
+
+
+# Type of the permutation views. Must match `PermView` in 'sort.cpp'.
+_perm_view_type(view_t::Type{<:View}) = View{Int64, 1, LayoutLeft, memory_space(view_t)}
+
+
+function compile_sort(exec_space::ExecutionSpace, view_t::Type{<:View})
+    @nospecialize exec_space view_t
+    compile_view(view_t; for_function=_sort, no_error=true)
+    compile_view(_perm_view_type(view_t); for_function=_bin_sort, no_error=true)
+
+    view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(view_t)
+    DynamicCompilation.compile_and_load(@__MODULE__, "sort";
+        view_type, view_dim, view_layout, mem_space, mem_traits,
+        exec_space=typeof(exec_space)
+    )
+end
+
+
+function _sort(exec_space::ExecutionSpace, v::View)
+    @nospecialize exec_space v
+    return DynamicCompilation.@compile_and_call(_sort, (exec_space, v),
+        compile_sort(exec_space, typeof(v))
+    )
+end
+
+
+function _bin_sort(
+    exec_space::ExecutionSpace, keys::View, perm::View,
+    bin_count::Int64, sort_within_bins::Bool, sort_keys::Bool
+)
+    @nospecialize exec_space keys perm bin_count sort_within_bins sort_keys
+    return DynamicCompilation.@compile_and_call(
+        _bin_sort, (exec_space, keys, perm, bin_count, sort_within_bins, sort_keys),
+        compile_sort(exec_space, typeof(keys))
+    )
+end
+
+
+function _permute(exec_space::ExecutionSpace, v::View, perm::View)
+    @nospecialize exec_space v perm
+    return DynamicCompilation.@compile_and_call(_permute, (exec_space, v, perm),
+        compile_sort(exec_space, typeof(v))
+    )
+end
+
+
+"""
+    sort!(v::View{T, 1}; rev=false, exec_space=nothing)
+
+Sort `v` in parallel on `exec_space` (defaulting to the [`execution_space`](@ref) of the memory space
+of `v`) with `Kokkos::sort`.
+
+Only views of `Float32`, `Float64` or integers of 64 bits or less are sorted natively. Other element
+types and other keyword arguments (`by`, `lt`, `order`...) fall back to the generic method.
+
+`sort(v)` also relies on this method, after copying `v`.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.sort!(v::View{T, 1}; rev=false, exec_space=nothing, kwargs...) where {T}
+    if !isempty(kwargs) || !(T <: NativeReductionTypes)
+        return invoke(sort!, Tuple{AbstractVector}, v; rev, kwargs...)
+    end
+    exec_space = something(exec_space, _default_exec_space(v))
+    _sort(exec_space, v)
+    rev && reverse!(v; exec_space)
+    return v
+end
+
+
+"""
+    bin_sort(keys::View{T, 1}; bin_count=length(keys) ÷ 2, sort_within_bins=true, exec_space=nothing)
+
+Return the permutation which sorts `keys`, as a new `View{Int64, 1}` in the same memory space as
+`keys`: `keys[bin_sort(keys)]` is sorted. `keys` is not modified.
+
+Keys are sorted in `bin_count` bins with `Kokkos::BinSort` and `Kokkos::BinOp1D`, distributed
+uniformly between the minimum and maximum key. If `sort_within_bins == false`, keys are only sorted
+by bins, and the permutation only partially sorts `keys`. The sort is not stable.
+Keys cannot be `NaN`.
+
+The sort is done in parallel on `exec_space`, which defaults to the [`execution_space`](@ref) of the
+memory space of `keys`.
+
+See also [`bin_sort!`](@ref) and [`sort_by_key!`](@ref).
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function bin_sort(keys::View{T, 1}; exec_space=nothing, kwargs...) where {T}
+    return _bin_sort_perm(keys, false; exec_space, kwargs...)
+end
+
+
+"""
+    bin_sort!(keys::View{T, 1}; bin_count=length(keys) ÷ 2, sort_within_bins=true, exec_space=nothing)
+
+Same as [`bin_sort`](@ref), but `keys` are also sorted. The permutation is returned.
+"""
+function bin_sort!(keys::View{T, 1}; exec_space=nothing, kwargs...) where {T}
+    return _bin_sort_perm(keys, true; exec_space, kwargs...)
+end
+
+
+function _bin_sort_perm(keys::View{T, 1}, sort_keys::Bool;
+    bin_count = max(length(keys) ÷ 2, 1),
+    sort_within_bins = true,
+    exec_space = nothing
+) where {T}
+    if !(T <: NativeReductionTypes)
+        error("`bin_sort` only supports views of floats or integers, got: $(main_view_type(keys))")
+    end
+    exec_space = something(exec_space, _default_exec_space(keys))
+    perm = _perm_view_type(typeof(keys))(undef, length(keys))
+    _bin_sort(exec_space, keys, perm, Int64(bin_count), Bool(sort_within_bins), sort_keys)
+    return perm
+end
+
+
+"""
+    sort_by_key!(keys::View{K, 1}, values::View{V, 1}; bin_count=length(keys) ÷ 2, sort_within_bins=true, exec_space=nothing)
+
+Sort `keys` with [`bin_sort!`](@ref), then apply the same permutation to `values`.
+Both views must be in the same memory space. Returns `keys` and `values`.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function sort_by_key!(keys::View{K, 1}, values::View{V, 1}; exec_space=nothing, kwargs...) where {K, V}
+    if length(keys) != length(values)
+        throw(DimensionMismatch("keys have length $(length(keys)) while values have length $(length(values))"))
+    end
+    if memory_space(keys) !== memory_space(values)
+        error("keys and values must be in the same memory space, got: $(memory_space(keys)) and $(memory_space(values))")
+    end
+    exec_space = something(exec_space, _default_exec_space(keys))
+    perm = bin_sort!(keys; exec_space, kwargs...)
+    permute!(values, perm; exec_space)
+    return keys, values
+end
+
+
+"""
+    permute!(v::View{T, 1}, perm::View{Int64, 1}; exec_space=nothing)
+
+Permute `v` in-place: `v` becomes `v[perm]`. Done in parallel on `exec_space` (defaulting to the
+[`execution_space`](@ref) of the memory space of `v`) if `perm` is a `LayoutLeft` view in the same
+memory space as `v`, like the ones returned by [`bin_sort`](@ref).
+Otherwise falls back to the generic method.
+
+An error is raised before modifying `v` if an index of `perm` is not in `1:length(v)`.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function Base.permute!(v::View{T, 1}, perm::View{Int64, 1}; exec_space=nothing) where {T}
+    if main_view_type(perm) !== main_view_type(_perm_view_type(typeof(v))) || length(v) != length(perm)
+        return invoke(permute!, Tuple{Any, AbstractVector}, v, perm)
+    end
+    _permute(something(exec_space, _default_exec_space(v)), v, perm)
+    return v
+end
@@ -227,6 +227,15 @@ Equivalent to [`exec_space.fence()`](https://kokkos.github.io/kokkos-core-wiki/A
 function fence(::ExecutionSpace) end
 
 
+# Defined in 'spaces.cpp', in 'register_space'. `fence` in a GC-safe region, for fences in background tasks.
+function __fence_gc_safe end
+
+
+# Defined in 'spaces.cpp', in 'register_space'. Non-blocking query of the completion of all work of an
+# execution space instance: 1 if done, 0 if not, -1 if not supported by the backend.
+function __query_completion end
+
+
 # Defined in 'spaces.cpp', in 'register_space'
 """
     concurrency(exec_space::ExecutionSpace)
@@ -238,28 +247,71 @@ Equivalent to [`exec_space.concurrency()`](https://kokkos.github.io/kokkos-core-
 function concurrency end
 
 
+"""
+    partition_space(exec_space::ExecutionSpace, weights::AbstractVector{<:Real})
+    partition_space(exec_space::ExecutionSpace, n::Integer)
+
+Split `exec_space` into `length(weights)` (or `n` equal) new instances, each with a share of the
+resources of `exec_space` proportional to its weight (e.g. the threads of an `OpenMP` instance).
+
+Kernels and copies in different instances may run concurrently: each instance can be passed to
+[`deep_copy`](@ref) or to any method with an `exec_space` argument.
+For host backends, kernels are executed by the calling thread, therefore each instance should be
+used from a different Julia thread (e.g. with `Threads.@spawn`) to run concurrently.
+
+Execution spaces which cannot be partitioned return `n` copies of `exec_space`.
+
+Equivalent to `Kokkos::Experimental::partition_space(exec_space, weights)`.
+Requires Kokkos 4.0 or above.
+"""
+function partition_space(exec_space::ExecutionSpace, weights::AbstractVector{<:Real})
+    isempty(weights) && error("`partition_space` needs at least one weight")
+    if !all(w -> w > 0 && isfinite(w), weights)
+        error("`partition_space` weights must be positive, got: $weights")
+    end
+    return __partition_space(exec_space, Vector{Float64}(weights))
+end
+
+partition_space(exec_space::ExecutionSpace, n::Integer) = partition_space(exec_space, ones(Float64, n))
+
+
+# Defined in 'spaces.cpp', in 'register_space'
+function __partition_space end
+
+
 # Defined in 'spaces.cpp', in 'register_space'
 """
     allocate(mem_space::MemorySpace, bytes)
+    allocate(mem_space::MemorySpace, label::AbstractString, bytes)
 
 Allocate `bytes` on the memory space instance. Returns a pointer to the allocated memory.
+Kokkos Tools see the allocation with the `label`, or `"[unlabeled]"`.
 
 Equivalent to [`mem_space.allocate(bytes)`](https://kokkos.github.io/kokkos-core-wiki/API/core/memory_spaces.html#functions)
+or `mem_space.allocate(label, bytes)`.
 """
 function allocate end
 
 
 # Defined in 'spaces.cpp', in 'register_space'
 """
-    deallocate(mem_space::MemorySpace, ptr)
+    deallocate(mem_space::MemorySpace, ptr, bytes)
+    deallocate(mem_space::MemorySpace, label::AbstractString, ptr, bytes)
 
-Frees `ptr`, previously allocated with [`allocate`](@ref).
+Frees `ptr`, previously allocated with [`allocate`](@ref), with the same `label` if any.
 
 Equivalent to [`mem_space.deallocate(ptr, bytes)`](https://kokkos.github.io/kokkos-core-wiki/API/core/memory_spaces.html#functions)
+or `mem_space.deallocate(label, ptr, bytes)`.
 """
 function deallocate end
 
 
+# Defined in 'spaces.cpp', in 'register_space'
+# `__relabel_allocation(mem_space, ptr, bytes, old_label, new_label)`: signal to Kokkos Tools that
+# the allocation at `ptr` now belongs to `new_label`, without freeing it.
+function __relabel_allocation end
+
+
 # Defined in 'spaces.cpp', in 'register_all'
 """
     ENABLED_EXEC_SPACES::Tuple{Vararg{Type{<:ExecutionSpace}}}
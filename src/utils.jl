@@ -115,7 +115,21 @@ function initialize(;
     !isnothing(tools_libs)          && tools_libs!(settings, tools_libs)
     !isnothing(tools_args)          && tools_args!(settings, tools_args)
     !isnothing(map_device_id_by)    && map_device_id_by!(settings, map_device_id_by)
-    Base.invokelatest(initialize, settings)
+    initialize(settings)
+    return
+end
+
+
+"""
+    initialize(settings)
+
+Initializes Kokkos with `settings`, an `InitializationSettings` object from the wrapper library.
+Prefer the keyword arguments version of [`initialize`](@ref).
+"""
+function initialize(settings)
+    Base.invokelatest(get_impl_module().__initialize, settings)
+    _update_tools_loaded()
+    return
 end
 
 
@@ -220,6 +234,9 @@ function configinfo(io::IO = stdout)
     println(io, "CMake options: ", `$KOKKOS_CMAKE_OPTIONS`)
     println(io, "CMake build type: ", KOKKOS_BUILD_TYPE)
     println(io, "CMake build dir: '", KOKKOS_BUILD_DIR, "'")
+    println(io, "Compiled libraries cache dir: ", something(KOKKOS_LIBS_CACHE_DIR, "<in the wrapper build dir>"))
+    println(io, "Compiled libraries cache size: ", something(KOKKOS_LIBS_CACHE_SIZE, "<unlimited>"))
+    println(io, "Prebuilt views: ", something(KOKKOS_PREBUILT_VIEWS, "<none>"))
     println(io, "Kokkos options: ", `$KOKKOS_LIB_OPTIONS`)
     println(io, "Enabled Kokkos backends: ", join(KOKKOS_BACKENDS, ", "))
 end
@@ -284,8 +301,8 @@ end
 
 function __validate_parameters(;
     view_layout, view_dim, view_type,
-    exec_space, mem_space,
-    dest_layout, dest_space,
+    exec_space, mem_space, mem_traits,
+    dest_layout, dest_space, dest_mem_traits,
     subview_dim
 )
     all_dims = filter(!isnothing, union([view_dim], [subview_dim]))
@@ -315,10 +332,12 @@ function __validate_parameters(;
     dest_space  = isnothing(dest_space)  ? "" : string(nameof(main_space_type(dest_space)))
     view_layout = isnothing(view_layout) ? "" : lowercase(string(nameof(view_layout)))[7:end]  # Remove leading 'Layout'
     dest_layout = isnothing(dest_layout) ? "" : lowercase(string(nameof(dest_layout)))[7:end]
+    mem_traits  = isnothing(mem_traits)  ? "" : string(memory_traits_flags(mem_traits))
+    dest_mem_traits = isnothing(dest_mem_traits) ? "" : string(memory_traits_flags(dest_mem_traits))
 
     return view_layout, view_dim, view_type,
-           exec_space, mem_space,
-           dest_layout, dest_space,
+           exec_space, mem_space, mem_traits,
+           dest_layout, dest_space, dest_mem_traits,
            subview_dim
 end
 
@@ -0,0 +1,215 @@
+# Pooled allocation of views, from blocks allocated with `Kokkos.allocate` and reused after the
+# views are finalized.
+# Included in the `Kokkos.Views` module.
+
+export enable_view_pool, disable_view_pool, view_pool_stats
+
+
+# Smallest block size of the pools, in bytes
+const _POOL_MIN_BLOCK_SIZE = 64
+
+# Label of the blocks cached by the pools, for Kokkos Tools
+const _POOL_LABEL = "Kokkos.jl::view_pool"
+
+
+mutable struct ViewPool
+    mem_space::MemorySpace
+    enabled::Bool
+    closed::Bool  # Set after `Kokkos.finalize`: no memory can be allocated or freed anymore
+    free_blocks::Dict{Int, Vector{Ptr{Cvoid}}}  # By block size
+    lock::ReentrantLock
+    hits::Int
+    misses::Int
+    cached_bytes::Int
+    in_use_bytes::Int
+end
+
+ViewPool(mem_space::MemorySpace) =
+    ViewPool(mem_space, true, false, Dict{Int, Vector{Ptr{Cvoid}}}(), ReentrantLock(), 0, 0, 0, 0)
+
+
+const _VIEW_POOLS = Dict{Type{<:MemorySpace}, ViewPool}()
+const _VIEW_POOLS_LOCK = ReentrantLock()
+
+
+_pool_block_size(bytes) = nextpow(2, max(bytes, _POOL_MIN_BLOCK_SIZE))
+
+
+function _view_pool(mem_space::Type{<:MemorySpace})
+    # The lock is only taken if any pool was created
+    isempty(_VIEW_POOLS) && return nothing
+    pool = lock(() -> get(_VIEW_POOLS, main_space_type(mem_space), nothing), _VIEW_POOLS_LOCK)
+    return (isnothing(pool) || !pool.enabled) ? nothing : pool
+end
+
+
+function _acquire_block(pool::ViewPool, bytes)
+    block_size = _pool_block_size(bytes)
+    ptr = lock(pool.lock) do
+        pool.closed && error("cannot allocate from the view pool of $(typeof(pool.mem_space)) after `Kokkos.finalize`")
+        blocks = get(pool.free_blocks, block_size, nothing)
+        pool.in_use_bytes += block_size
+        if isnothing(blocks) || isempty(blocks)
+            pool.misses += 1
+            return C_NULL
+        else
+            pool.hits += 1
+            pool.cached_bytes -= block_size
+            return pop!(blocks)
+        end
+    end
+    if ptr == C_NULL
+        try
+            # Allocated as a cached block, relabeled for the view by `_alloc_pooled_view`
+            ptr = allocate(pool.mem_space, _POOL_LABEL, block_size)
+        catch
+            lock(() -> (pool.in_use_bytes -= block_size), pool.lock)
+            rethrow()
+        end
+    end
+    return ptr, block_size
+end
+
+
+function _release_block(pool::ViewPool, ptr::Ptr{Cvoid}, block_size, label)
+    # Called with `pool.lock` held
+    pool.in_use_bytes -= block_size
+    pool.closed && return  # All memory is already freed by `Kokkos.finalize`
+    if pool.enabled
+        __relabel_allocation(pool.mem_space, ptr, block_size, label, _POOL_LABEL)
+        push!(get!(() -> Ptr{Cvoid}[], pool.free_blocks, block_size), ptr)
+        pool.cached_bytes += block_size
+    else
+        deallocate(pool.mem_space, label, ptr, block_size)
+    end
+end
+
+
+# Finalizer of pooled views, giving back their block to the pool
+struct _PooledBlockRelease
+    pool::ViewPool
+    ptr::Ptr{Cvoid}
+    block_size::Int
+    label::String
+end
+
+function (release::_PooledBlockRelease)(view::View)
+    # Finalizers cannot wait for a lock: try again later if the pool is in use
+    if trylock(release.pool.lock)
+        try
+            _release_block(release.pool, release.ptr, release.block_size, release.label)
+        finally
+            unlock(release.pool.lock)
+        end
+    else
+        finalizer(release, view)
+    end
+end
+
+
+function _alloc_pooled_view(pool::ViewPool, view_t::Type{<:View}, dims::Dims, layout, label, zero_fill)
+    ptr, block_size = _acquire_block(pool, prod(dims; init=1) * sizeof(eltype(view_t)))
+    # Pooled views are unmanaged: Kokkos Tools only see their block, which takes the label of the view
+    label = String(label)
+    __relabel_allocation(pool.mem_space, ptr, block_size, _POOL_LABEL, label)
+    layout = layout isa DataType ? nothing : layout
+    view = view_wrap(view_t, dims, layout, Ptr{eltype(view_t)}(ptr))
+    finalizer(_PooledBlockRelease(pool, ptr, block_size, label), view)
+    zero_fill && fill!(view, zero(eltype(view_t)))
+    return view
+end
+
+
+function _free_pool_blocks(pool::ViewPool)
+    # Called with `pool.lock` held
+    pool.closed && return
+    for (block_size, blocks) in pool.free_blocks, ptr in blocks
+        deallocate(pool.mem_space, _POOL_LABEL, ptr, block_size)
+    end
+    empty!(pool.free_blocks)
+    pool.cached_bytes = 0
+end
+
+
+function _close_view_pools()
+    # Called by `_finalize_all_views`, after all tracked views were finalized
+    lock(_VIEW_POOLS_LOCK) do
+        for pool in values(_VIEW_POOLS)
+            lock(pool.lock) do
+                _free_pool_blocks(pool)
+                pool.closed = true
+            end
+        end
+    end
+end
+
+
+"""
+    enable_view_pool(mem_space::Type{<:MemorySpace} = DEFAULT_DEVICE_MEM_SPACE)
+
+Enable the pooled allocation of views in `mem_space`.
+
+Views constructed afterwards in `mem_space` draw their memory from a pool of blocks, allocated with
+[`allocate`](@ref), and give it back to the pool when they are finalized (manually with
+`finalize(view)` or by the GC), instead of freeing it. Blocks have a size of a power of 2 bytes.
+This avoids a full allocation round-trip for short-lived views with the same sizes, like temporary
+buffers allocated at each iteration.
+
+Only views with a [`LayoutLeft`](@ref) or [`LayoutRight`](@ref) and without `dim_pad=true` or an
+explicit `mem_space` instance are pooled. Pooled views are unmanaged (see [`view_wrap`](@ref)):
+their block is given back to the pool once the view, all of its [`subview`](@ref)s and the mirrors
+aliasing it (from [`create_mirror_view`](@ref)) are finalized. Copies of a pooled view made in C++
+do not keep its block, and must not outlive it.
+
+For Kokkos Tools (and the [memory telemetry](@ref enable_memory_telemetry)), a block in use is allocated with the `label` of
+its view, and a block cached by the pool with the `"$_POOL_LABEL"` label.
+
+All memory held by the pools is freed upon [`finalize`](@ref). See [`view_pool_stats`](@ref) for
+statistics of the pool.
+"""
+function enable_view_pool(mem_space::Type{<:MemorySpace} = DEFAULT_DEVICE_MEM_SPACE)
+    mem_space = main_space_type(mem_space)
+    lock(_VIEW_POOLS_LOCK) do
+        pool = get!(() -> ViewPool(mem_space()), _VIEW_POOLS, mem_space)
+        pool.enabled = true
+    end
+    return nothing
+end
+
+
+"""
+    disable_view_pool(mem_space::Type{<:MemorySpace} = DEFAULT_DEVICE_MEM_SPACE)
+
+Disable the pooled allocation of views in `mem_space`, and free all blocks cached by its pool.
+Blocks of pooled views still alive are freed when they are finalized.
+"""
+function disable_view_pool(mem_space::Type{<:MemorySpace} = DEFAULT_DEVICE_MEM_SPACE)
+    pool = lock(() -> get(_VIEW_POOLS, main_space_type(mem_space), nothing), _VIEW_POOLS_LOCK)
+    isnothing(pool) && return nothing
+    lock(pool.lock) do
+        pool.enabled = false
+        _free_pool_blocks(pool)
+    end
+    return nothing
+end
+
+
+"""
+    view_pool_stats(mem_space::Type{<:MemorySpace} = DEFAULT_DEVICE_MEM_SPACE)
+
+Statistics of the view pool of `mem_space`, as a `NamedTuple`:
+ - `enabled`: if views are currently allocated from the pool
+ - `hits`: number of views allocated with a block reused from the pool
+ - `misses`: number of views for which a new block was allocated
+ - `cached_bytes`: total size of the blocks held by the pool, ready for reuse
+ - `in_use_bytes`: total size of the blocks used by pooled views which are not yet finalized
+
+See [`enable_view_pool`](@ref).
+"""
+function view_pool_stats(mem_space::Type{<:MemorySpace} = DEFAULT_DEVICE_MEM_SPACE)
+    pool = lock(() -> get(_VIEW_POOLS, main_space_type(mem_space), nothing), _VIEW_POOLS_LOCK)
+    isnothing(pool) && return (; enabled=false, hits=0, misses=0, cached_bytes=0, in_use_bytes=0)
+    return lock(pool.lock) do
+        (; pool.enabled, pool.hits, pool.misses, pool.cached_bytes, pool.in_use_bytes)
+    end
+end
@@ -4,24 +4,45 @@ using CxxWrap
 import ..Kokkos: DynamicCompilation
 import ..Kokkos: ExecutionSpace, MemorySpace, HostSpace
 import ..Kokkos: Layout, LayoutLeft, LayoutRight, LayoutStride
-import ..Kokkos: ENABLED_MEM_SPACES, DEFAULT_DEVICE_MEM_SPACE, DEFAULT_HOST_MEM_SPACE, Idx
+import ..Kokkos: MemoryTraits, Unmanaged, Atomic, has_memory_trait, memory_traits_flags
+import ..Kokkos: ENABLED_MEM_SPACES, DEFAULT_DEVICE_MEM_SPACE, DEFAULT_HOST_MEM_SPACE, DEFAULT_DEVICE_SPACE, Idx
+import ..Kokkos: Wrapper
+import ..Kokkos: allocate, deallocate, __relabel_allocation
 import ..Kokkos: ensure_kokkos_wrapper_loaded, get_impl_module
-import ..Kokkos: memory_space, execution_space, accessible, array_layout, main_space_type, finalize
+import ..Kokkos: memory_space, execution_space, accessible, array_layout, main_space_type, finalize, fence
+import ..Kokkos: __fence_gc_safe, __query_completion
 
 export View
 export impl_view_type, main_view_type, label, view_wrap, view_data, memory_span, span_is_contiguous
+export update_metadata!
+export memory_traits
 export cxx_type_name, subview, deep_copy, host_mirror, host_mirror_space, create_mirror, create_mirror_view
+export DeepCopyHandle, isdone
+export prebuild_views
 
 
 """
-    View{T, D, Layout, MemSpace} <: AbstractArray{T, D}
+    View{T, D, Layout, MemSpace, MemTraits} <: AbstractArray{T, D}
 
 Wrapper around a `Kokkos::View` of `D` dimensions of type `T`, stored in `MemSpace` using the
-`Layout`.
+`Layout`, with the [`MemoryTraits`](@ref) `MemTraits`.
 
-Behaves like a normal `Array`. Indexing is done by calling the `Kokkos::View::operator()` function
-of the view, and is therefore not highly performant. The best performance with Kokkos views is
-achieved by calling Kokkos kernels compiled from C++.
+`View{T, D, Layout, MemSpace}` (without `MemTraits`) is a `UnionAll` type, but wherever a complete
+view type is expected it stands for `View{T, D, Layout, MemSpace, MemoryTraits{0}}`.
+
+Behaves like a normal `Array`. The data pointer, dimensions and strides of the view are cached in the
+view object when it is constructed, therefore `size`, `strides` and indexing with integers are done
+directly from Julia, without any call to the C++ library. If the view is assigned to from C++, the
+cache must be updated with [`update_metadata!`](@ref). The best performance with Kokkos views is
+still achieved by calling Kokkos kernels compiled from C++.
+
+Elements of views with the [`Atomic`](@ref) memory trait are loaded and stored atomically if they
+are `Bool`, integers or floats. Elements of other types are accessed non-atomically. An update like
+`v[i] += x` is a separate load and store, not an atomic addition.
+
+Indexing with ranges or `:` (e.g. `v[:, 1]` or `v[2:3, :] = a`) copies the whole region to (or
+from) an `Array` in a single call, using a kernel on the default host execution space. `copyto!`
+between a `View` and an `Array` of the same size works the same way.
 
 It is supposed that all view accesses are done from the default host execution space. Since the view
 may be stored in a memory space different from the host, it may be invalid to access its elements:
@@ -36,11 +57,28 @@ It is important to understand that for a view to be properly disposed of, there
    will always meet this requirement.
  - [`finalize`](@ref) wasn't called.
 """
-abstract type View{T, D, L <: Layout, M <: MemorySpace} <: Base.AbstractArray{T, D} end
+abstract type View{T, D, L <: Layout, M <: MemorySpace, MT <: MemoryTraits} <: Base.AbstractArray{T, D} end
+
+
+# Mirrors `ViewMetadata` in 'views.h': cached when the view is constructed and placed after the
+# `Kokkos::View` in the C++ object, at the same offset for all view types. Reading it requires no call
+# to the view's library.
+struct ViewMetadata{T, D}
+    data::Ptr{T}
+    host_accessible::Bool
+    dims::NTuple{D, Int64}
+    strides::NTuple{D, Int64}
+end
+
+# Must match `VIEW_METADATA_OFFSET` in 'views.h'
+const VIEW_METADATA_OFFSET = 256
+
+@inline _metadata(v::View{T, D}) where {T, D} =
+    unsafe_load(Ptr{ViewMetadata{T, D}}(v.cpp_object + VIEW_METADATA_OFFSET))
 
 
 function _extract_view_params(view_t::Type{<:View})
-    return eltype(view_t), ndims(view_t), array_layout(view_t), memory_space(view_t)
+    return eltype(view_t), ndims(view_t), array_layout(view_t), memory_space(view_t), memory_traits(view_t)
 end
 
 
@@ -70,9 +108,9 @@ function compile_view(view_t::Type{<:View}; for_function=nothing, no_error=false
     @debug "Compiling view $view_t"
 
     try
-        view_type, view_dim, view_layout, mem_space = _extract_view_params(view_t)
+        view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(view_t)
         DynamicCompilation.compile_and_load(@__MODULE__, "views";
-            view_type, view_dim, view_layout, mem_space
+            view_type, view_dim, view_layout, mem_space, mem_traits
         )
     catch
         println(stderr, "Defined types: ")
@@ -88,6 +126,89 @@ function compile_view(view_t::Type{<:View}; for_function=nothing, no_error=false
 end
 
 
+function _prebuilt_views_manifest(view_types)
+    manifest = Pair{String, NamedTuple}[]
+    for view_t in view_types
+        view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(view_t)
+        params = (; view_type, view_dim, view_layout, mem_space, mem_traits)
+
+        push!(manifest, "views" => params)
+        push!(manifest, "mirrors" => (; params..., with_nothing_arg=true))
+        for sub_dim in 1:view_dim
+            push!(manifest, "subviews" => (; params..., subview_dim=sub_dim))
+        end
+
+        # Copies between all prebuilt views of the same element type and dimension
+        for dest_t in view_types
+            _, dest_dim, dest_layout, dest_space, dest_mem_traits = _extract_view_params(dest_t)
+            (eltype(dest_t) !== view_type || dest_dim != view_dim) && continue
+            push!(manifest, "copy" => (; params...,
+                dest_layout, dest_space, dest_mem_traits, without_exec_space_arg=true
+            ))
+        end
+    end
+    return manifest
+end
+
+
+"""
+    prebuild_views(view_types; no_compilation=false)
+
+Compile in a single batch (see [`DynamicCompilation.compile_batch`](@ref)) the libraries needed to
+create, copy, mirror and take subviews of views of each type in `view_types`, then register all
+view types.
+Copies are compiled only between views of `view_types` with the same element type and dimension.
+
+If `no_compilation` is `true`, the batch compilation is skipped and view types are only registered:
+libraries missing from the cache are then compiled one by one.
+
+This is done automatically for the [prebuilt_views](@ref) configuration option when loading the
+wrapper library.
+
+```julia
+Kokkos.prebuild_views([View{T, D, L, Kokkos.HostSpace}
+                       for T in (Float64, Int64), D in 1:2, L in (LayoutLeft, LayoutRight)])
+```
+"""
+function prebuild_views(view_types; no_compilation=false)
+    view_types = unique(main_view_type.(view_types))
+    if !no_compilation
+        DynamicCompilation.compile_batch(_prebuilt_views_manifest(view_types))
+    end
+    foreach(view_t -> compile_view(view_t; no_error=true), view_types)
+    return view_types
+end
+
+
+function _prebuilt_view_types(config)
+    kokkos = parentmodule(@__MODULE__)
+    types = [getfield(Base, Symbol(t)) for t in config["types"]]
+    dims = config["dims"]
+    layouts = [getfield(kokkos, Symbol(l)) for l in config["layouts"]]
+    if haskey(config, "mem_spaces")
+        mem_spaces = [getfield(kokkos, Symbol(s)) for s in config["mem_spaces"]]
+        filter!(s -> s in ENABLED_MEM_SPACES, mem_spaces)
+    else
+        mem_spaces = filter(accessible, collect(ENABLED_MEM_SPACES))
+    end
+
+    for T in types
+        isbitstype(T) || error("prebuilt views must have a bits type as their element type, got: $T")
+    end
+
+    return [View{T, D, L, S} for T in types, D in dims, L in layouts, S in mem_spaces] |> vec
+end
+
+
+function __init_prebuilt_views(; no_compilation=false)
+    config = parentmodule(@__MODULE__).KOKKOS_PREBUILT_VIEWS
+    isnothing(config) && return
+    @debug "Loading prebuilt views..."
+    prebuild_views(_prebuilt_view_types(config); no_compilation)
+    return
+end
+
+
 function alloc_view(
     view_t::Type{<:View},
     dims::Dims, mem_space, layout,
@@ -116,6 +237,26 @@ end
 _get_ptr(v::View, i::Tuple{Vararg{Integer}}) = _get_ptr(v, i...)
 
 
+# Defined in 'views.cpp', in 'register_region_copy'
+function _copy_to_array(
+    @nospecialize(v::View), @nospecialize(start::Dims), @nospecialize(count::Dims), @nospecialize(dest::Ptr)
+)
+    return DynamicCompilation.@compile_and_call(_copy_to_array, (v, start, count, dest),
+        compile_view(typeof(v); for_function=_copy_to_array, no_error=true)
+    )
+end
+
+
+# Defined in 'views.cpp', in 'register_region_copy'
+function _copy_from_array(
+    @nospecialize(v::View), @nospecialize(start::Dims), @nospecialize(count::Dims), @nospecialize(src::Ptr)
+)
+    return DynamicCompilation.@compile_and_call(_copy_from_array, (v, start, count, src),
+        compile_view(typeof(v); for_function=_copy_from_array, no_error=true)
+    )
+end
+
+
 function _get_dims(@nospecialize(v::View))
     return DynamicCompilation.@compile_and_call(_get_dims, (v,),
         compile_view(typeof(v); for_function=_get_dims, no_error=true)
@@ -130,6 +271,41 @@ function _get_strides(@nospecialize(v::View))
 end
 
 
+# Offset of the metadata in the C++ objects of views of type `view_t`, to check `VIEW_METADATA_OFFSET`
+function _get_metadata_offset(@nospecialize(view_t::Type{<:View}))
+    return DynamicCompilation.@compile_and_call(_get_metadata_offset, (view_t,),
+        compile_view(view_t; for_function=_get_metadata_offset, no_error=true)
+    )
+end
+
+
+"""
+    update_metadata!(v::View)
+
+Update the dimensions, strides and data pointer of `v` cached on the Julia side.
+
+This must be called after the C++ view was modified in place, e.g. when it is assigned to by a C++
+function taking a `Kokkos::View&` (passed as a `Ref{View}` in a `ccall`). Until then, `size(v)`,
+`strides(v)`, `pointer(v)` and indexing would use the old values.
+
+This function relies on [Dynamic Compilation](@ref).
+"""
+function update_metadata!(@nospecialize(v::View))
+    return DynamicCompilation.@compile_and_call(update_metadata!, (v,),
+        compile_view(typeof(v); for_function=update_metadata!, no_error=true)
+    )
+end
+
+
+# A new C++ copy of `v`, sharing its data and holding its own reference to its allocation. It is not
+# tracked: it is not finalized by `Kokkos.finalize`.
+function _untracked_copy(@nospecialize(v::View))
+    return DynamicCompilation.@compile_and_call(_untracked_copy, (v,),
+        compile_view(typeof(v); for_function=_untracked_copy, no_error=true)
+    )
+end
+
+
 function get_tracker(@nospecialize(v::View))
     return DynamicCompilation.@compile_and_call(get_tracker, (v,),
         compile_view(typeof(v); for_function=get_tracker, no_error=true)
@@ -140,6 +316,9 @@ end
 include("weak_view_dict.jl")
 const TRACKED_VIEWS = WeakViewDict()
 
+# Views whose data is owned by a Julia object (e.g. the array of `View(array)`), rooted by the view
+const JULIA_OWNED_VIEWS = WeakViewDict()
+
 
 function _finalize_all_views()
     # Called by `Kokkos::finalize` through a finalize hook. All views allocated by Kokkos.jl will be
@@ -156,6 +335,8 @@ function _finalize_all_views()
         end
         empty!(TRACKED_VIEWS)
     end
+
+    _close_view_pools()
 end
 
 
@@ -183,6 +364,7 @@ false
 This function relies on [Dynamic Compilation](@ref).
 """
 function impl_view_type(@nospecialize(view_t::Type{<:View}))
+    view_t = main_view_type(view_t)
     return DynamicCompilation.@compile_and_call(impl_view_type, (view_t,),
         compile_view(view_t; for_function=impl_view_type, no_error=true)
     )
@@ -194,11 +376,14 @@ end
     main_view_type(::Type{<:View})
 
 The "main type" of the view: converts `Type{View1D_S_HostAllocated{Float64}}` into
-`Type{View{Float64, 1, LayoutStride, HostSpace}}`, which is easier to understand.
+`Type{View{Float64, 1, LayoutStride, HostSpace, MemoryTraits{0}}}`, which is easier to understand.
+
+View types with no memory traits (`View{T, D, L, S}`) are completed with `MemoryTraits{0}`.
 
 The opposite of [`impl_view_type`](@ref).
 """
-main_view_type(::Type{<:View{T, D, L, S}}) where {T, D, L, S} = View{T, D, L, main_space_type(S)}
+main_view_type(::Type{<:View{T, D, L, S, MT}}) where {T, D, L, S, MT} = View{T, D, L, main_space_type(S), MT}
+main_view_type(::Type{View{T, D, L, S}}) where {T, D, L, S} = View{T, D, L, main_space_type(S), MemoryTraits{0}}
 main_view_type(v::View) = main_view_type(supertype(supertype(typeof(v))))
 
 
@@ -244,6 +429,17 @@ memory_space(v::View) = memory_space(typeof(v))
 memory_space(::Type{<:View{T, D, L, MemSpace}}) where {T, D, L, MemSpace} = main_space_type(MemSpace)
 
 
+"""
+    memory_traits(::View)
+    memory_traits(::Type{<:View})
+
+Return the [`MemoryTraits`](@ref) type of the view.
+"""
+memory_traits(v::View) = memory_traits(typeof(v))
+memory_traits(::Type{<:View{T, D, L, S, MT}}) where {T, D, L, S, MT} = MT
+memory_traits(::Type{View{T, D, L, S}}) where {T, D, L, S} = MemoryTraits{0}
+
+
 """
     label(::View)
 
@@ -347,7 +543,8 @@ Performs a copy of all data from `src` to `dest`.
 In order for the copy to be possible, both views must have the same dimension, and either have the
 same layout or are both accessible from `space`.
 
-If a `space` is given, the copy may be asynchronous. If not the copy will be synchronous.
+If a `space` is given, the copy may be asynchronous, and a [`DeepCopyHandle`](@ref) is returned to
+wait for its completion. If not the copy will be synchronous.
 
 Equivalent to `Kokkos::deep_copy(dest, src)` or `Kokkos::deep_copy(space, dest, src)`.
 [See the Kokkos docs about `Kokkos::deep_copy`](https://kokkos.github.io/kokkos-core-wiki/API/core/view/deep_copy.html#deep-copy)
@@ -371,21 +568,21 @@ function deep_copy(dest::View, src::View)
                    src=$(ndims(src)), dest=$(ndims(dest))")
         end
 
-        view_type, view_dim, view_layout, mem_space = _extract_view_params(typeof(src))
-        _, _, dest_layout, dest_space = _extract_view_params(typeof(dest))
+        view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(typeof(src))
+        _, _, dest_layout, dest_space, dest_mem_traits = _extract_view_params(typeof(dest))
 
         DynamicCompilation.compile_and_load(@__MODULE__, "copy";
             view_type, view_dim, view_layout,
-            mem_space, dest_layout, dest_space,
+            mem_space, mem_traits, dest_layout, dest_space, dest_mem_traits,
             without_exec_space_arg = true
         )
     end)
 end
 
 
-function deep_copy(space::ExecutionSpace, dest::View, src::View)
+function _deep_copy(space::ExecutionSpace, dest::View, src::View)
     @nospecialize space dest src
-    return DynamicCompilation.@compile_and_call(deep_copy, (space, dest, src), begin
+    return DynamicCompilation.@compile_and_call(_deep_copy, (space, dest, src), begin
         compile_view(typeof(dest); for_function=deep_copy, no_error=true)
         compile_view(typeof(src);  for_function=deep_copy, no_error=true)
 
@@ -400,12 +597,12 @@ function deep_copy(space::ExecutionSpace, dest::View, src::View)
                 src=$(ndims(src)), dest=$(ndims(dest))")
         end
 
-        view_type, view_dim, view_layout, mem_space = _extract_view_params(typeof(src))
-        _, _, dest_layout, dest_space = _extract_view_params(typeof(dest))
+        view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(typeof(src))
+        _, _, dest_layout, dest_space, dest_mem_traits = _extract_view_params(typeof(dest))
 
         DynamicCompilation.compile_and_load(@__MODULE__, "copy";
             view_type, view_dim, view_layout,
-            mem_space, dest_layout, dest_space,
+            mem_space, mem_traits, dest_layout, dest_space, dest_mem_traits,
             exec_space=typeof(space),
             without_exec_space_arg = false
         )
@@ -413,6 +610,107 @@ function deep_copy(space::ExecutionSpace, dest::View, src::View)
 end
 
 
+function deep_copy(space::ExecutionSpace, dest::View, src::View)
+    _deep_copy(space, dest, src)
+    return DeepCopyHandle(space, dest, src)
+end
+
+
+"""
+    DeepCopyHandle
+
+Completion handle of an asynchronous [`deep_copy`](@ref) in an execution space instance.
+
+- `wait(handle)` yields to the Julia scheduler until the copy is complete. The execution space
+  instance is fenced in another task, preferably on another Julia thread. The fence is done in a
+  GC-safe region: it does not prevent the garbage collector from running on other threads.
+- [`isdone(handle)`](@ref isdone) is `true` once the copy is complete, without blocking.
+- `fence(handle)` blocks the current thread until the copy is complete, like `fence(exec_space)`,
+  and therefore also waits for all other work in the same execution space instance.
+
+Completion is queried from the stream of `Cuda` and `HIP` instances, while `Serial`, `OpenMP` and
+`Threads` complete the copy before `deep_copy` returns. For other backends, completion is known
+through the fencing task, which is only started by the first call to `wait` or `isdone`: dropping
+the handle costs nothing.
+
+Both views are kept alive by the handle until it is garbage collected.
+"""
+mutable struct DeepCopyHandle
+    exec_space::ExecutionSpace
+    dest::View
+    src::View
+    @atomic task::Union{Nothing, Task}
+    @atomic done::Bool
+
+    DeepCopyHandle(exec_space, dest, src) = new(exec_space, dest, src, nothing, false)
+end
+
+
+function _fence_task(handle::DeepCopyHandle)
+    task = @atomic handle.task
+    !isnothing(task) && return task
+    new_task = Task(() -> __fence_gc_safe(handle.exec_space))
+    new_task.sticky = false  # Like `Threads.@spawn`
+    task, started = @atomicreplace handle.task nothing => new_task
+    if started
+        schedule(new_task)
+        return new_task
+    else
+        return task  # Started concurrently by another task
+    end
+end
+
+
+"""
+    isdone(handle::DeepCopyHandle)
+
+`true` if the copy of `handle` is complete. Never blocks.
+
+For backends which cannot query the completion of an execution space instance (see
+[`DeepCopyHandle`](@ref)), the first call starts the fencing task and yields once to it: it may
+return `false` even if the copy is complete.
+
+Rethrows the error of the fence, if any.
+"""
+function isdone(handle::DeepCopyHandle)
+    (@atomic handle.done) && return true
+    completion = __query_completion(handle.exec_space)
+    if completion == -1
+        task = @atomic handle.task
+        if isnothing(task)
+            task = _fence_task(handle)
+            yield()  # Give a chance to the fence to complete
+        end
+        istaskdone(task) || return false
+        wait(task)
+    elseif completion == 0
+        return false
+    end
+    @atomic handle.done = true
+    return true
+end
+
+
+function Base.wait(handle::DeepCopyHandle)
+    (@atomic handle.done) && return
+    wait(_fence_task(handle))
+    @atomic handle.done = true
+    return
+end
+
+function fence(handle::DeepCopyHandle)
+    fence(handle.exec_space)
+    task = @atomic handle.task
+    !isnothing(task) && wait(task)
+    @atomic handle.done = true
+    return nothing
+end
+
+Base.show(io::IO, handle::DeepCopyHandle) =
+    print(io, "DeepCopyHandle(", main_space_type(handle.exec_space), ", ",
+          (@atomic handle.done) ? "done" : "pending", ")")
+
+
 """
     host_mirror_space(view_t::Type{<:View})
     host_mirror_space(view::View)
@@ -448,7 +746,7 @@ function host_mirror(view_t::Type{<:View{T, D, L, S}}) where {T, D, L, S}
 
     # Kokkos::View::HostMirror, as defined in:
     # https://github.com/kokkos/kokkos/blob/32e1bfb6975a9bc0ddbfd6c138aab127c11071dd/core/src/Kokkos_View.hpp#L612-L616
-    return View{T, D, L, host_space}
+    return View{T, D, L, host_space, MemoryTraits{0}}
 end
 
 host_mirror(v::View) = host_mirror(typeof(v))
@@ -481,11 +779,11 @@ function create_mirror(src::View, mem_space, zero_fill)
     return DynamicCompilation.@compile_and_call(create_mirror, (src, mem_space, zero_fill), begin
         compile_view(typeof(src); for_function=create_mirror, no_error=true)
         compile_view(host_mirror(typeof(src)); for_function=create_mirror, no_error=true)
-        view_type, view_dim, view_layout, src_mem_space = _extract_view_params(typeof(src))
+        view_type, view_dim, view_layout, src_mem_space, mem_traits = _extract_view_params(typeof(src))
         dest_space = isnothing(mem_space) ? nothing : typeof(mem_space)
         DynamicCompilation.compile_and_load(@__MODULE__, "mirrors";
             view_type, view_dim, view_layout,
-            mem_space = src_mem_space, dest_space,
+            mem_space = src_mem_space, mem_traits, dest_space,
             with_nothing_arg = isnothing(mem_space)
         )
     end)
@@ -503,6 +801,10 @@ This function relies on [Dynamic Compilation](@ref).
 function create_mirror_view(src::View; mem_space = nothing, zero_fill = false, track = true)
     mirror = create_mirror_view(src, mem_space, zero_fill)
     track && push!(TRACKED_VIEWS, mirror)
+    # Like subviews, a mirror aliasing `src` must keep the owner of its data alive
+    if mirror !== src && pointer(mirror) == pointer(src) && _has_julia_owner(src)
+        _root_owner!(mirror, src)
+    end
     return mirror
 end
 
@@ -513,28 +815,57 @@ function create_mirror_view(src::View, mem_space, zero_fill)
             create_mirror_view, (src, mem_space, zero_fill), begin
         compile_view(typeof(src); for_function=create_mirror_view, no_error=true)
         compile_view(host_mirror(typeof(src)); for_function=create_mirror_view, no_error=true)
-        view_type, view_dim, view_layout, src_mem_space = _extract_view_params(typeof(src))
+        view_type, view_dim, view_layout, src_mem_space, mem_traits = _extract_view_params(typeof(src))
         dest_space = isnothing(mem_space) ? nothing : typeof(mem_space)
         DynamicCompilation.compile_and_load(@__MODULE__, "mirrors";
             view_type, view_dim, view_layout,
-            mem_space = src_mem_space, dest_space,
+            mem_space = src_mem_space, mem_traits, dest_space,
             with_nothing_arg = isnothing(mem_space)
         )
     end)
 end
 
 
+function compile_subviews(view_t::Type{<:View}, subview_dim::Type{<:Val}, for_function)
+    @nospecialize view_t subview_dim for_function
+    sub_dim = first(subview_dim.parameters)::Int
+
+    view_type, view_dim, view_layout, mem_space, mem_traits = _extract_view_params(view_t)
+
+    # Memory traits are kept by `Kokkos::subview`
+    sub_view_t = View{view_type, sub_dim, view_layout, mem_space, mem_traits}
+    compile_view(view_t;     for_function, no_error=true)
+    compile_view(sub_view_t; for_function, no_error=true)
+
+    if (view_layout != LayoutStride)
+        # We also need the strided version of the subview type since we are compiling for all
+        # `Kokkos::subview` instantiations which results in a view with `sub_dim` dimensions.
+        sub_view_strided = View{view_type, sub_dim, LayoutStride, mem_space, mem_traits}
+        compile_view(sub_view_strided; for_function, no_error=true)
+    end
+
+    DynamicCompilation.compile_and_load(@__MODULE__, "subviews";
+        view_type, view_dim, view_layout, mem_space, mem_traits, subview_dim=sub_dim
+    )
+end
+
+
 """
     subview(v::View, indexes...)
-    subview(v::View, indexes::Tuple{Vararg{Union{Int, Colon, AbstractUnitRange}}})
+    subview(v::View, indexes::Tuple{Vararg{Union{Int, Colon, AbstractUnitRange, StepRange{Int, Int}}}})
 
 Return a new `Kokkos.view` which will be a subview into the region specified by `indexes` of `v`,
 with the same memory space (but maybe not the same layout).
 
+Ranges with a step (e.g. `1:2:n`) are supported (with positive steps only), and always produce a
+subview with a [`LayoutStride`](@ref), with the step folded into its stride: no data is copied.
+
 Unspecified dimensions are completed by `:`, e.g. if `v` is a 3D view `(1,)` and `(1, :, :)` will
 return the same subview.
 
 If `v` is tracked to be automatically finalized, then the subview will be as well.
+The subview keeps `v` alive, and therefore the owner of its data if it has one (e.g. the array of
+[`View(array)`](@ref View(::DenseArray))).
 
 Equivalent to [`Kokkos::subview`](https://kokkos.github.io/kokkos-core-wiki/API/core/view/subview.html).
 
@@ -571,6 +902,11 @@ julia> Kokkos.subview(v, (1,))  # Equivalent to `(1, :)`
   5.0
   9.0
  13.0
+
+julia> Kokkos.subview(v, (1:2:4, :))  # Every other row
+2×4 Kokkos.Views.View{Float64, 2, Kokkos.LayoutStride, Kokkos.HostSpace}:
+ 1.0  5.0   9.0  13.0
+ 3.0  7.0  11.0  15.0
 ```
 
 !!! warning
@@ -581,28 +917,47 @@ julia> Kokkos.subview(v, (1,))  # Equivalent to `(1, :)`
 This function relies on [Dynamic Compilation](@ref).
 """
 function subview(view::View, indexes::Tuple, subview_dim::Type{<:Val}, subview_layout::Type)
-    @nospecialize view indexes subview_dim subview_layout
+    return _subview(view, _subview_bounds(view, indexes), subview_dim, subview_layout)
+end
+
+
+function _subview(view::View, bounds::Vector{Int64}, subview_dim::Type{<:Val}, subview_layout::Type)
+    @nospecialize view bounds subview_dim subview_layout
     return DynamicCompilation.@compile_and_call(
-            subview, (view, indexes, subview_dim, subview_layout), begin
-        view_t = typeof(view)
-        sub_dim = first(subview_dim.parameters)::Int
-
-        sub_view_t = View{eltype(view_t), sub_dim, array_layout(view_t), memory_space(view_t)}
-        compile_view(view_t;     for_function=subview, no_error=true)
-        compile_view(sub_view_t; for_function=subview, no_error=true)
-
-        if (array_layout(view_t) != LayoutStride)
-            # We also need the strided version of the subview type since we are compiling for all
-            # `Kokkos::subview` instantiations which results in a view with `sub_dim` dimensions.
-            sub_view_strided = View{eltype(view_t), sub_dim, LayoutStride, memory_space(view_t)}
-            compile_view(sub_view_strided; for_function=subview, no_error=true)
-        end
+        _subview, (view, bounds, subview_dim, subview_layout),
+        compile_subviews(typeof(view), subview_dim, subview)
+    )
+end
 
-        view_type, view_dim, view_layout, mem_space = _extract_view_params(view_t)
-        DynamicCompilation.compile_and_load(@__MODULE__, "subviews";
-            view_type, view_dim, view_layout, mem_space, subview_dim=sub_dim
-        )
-    end)
+
+# Start (0-based), step and length of the range selected by the index `i` in a dimension of length `n`,
+# or `nothing` if out of bounds. Integer indexes have a step of 0.
+_index_bounds(n, ::Colon) = (0, 1, n)
+_index_bounds(n, i::Int) = 1 ≤ i ≤ n ? (i - 1, 0, 1) : nothing
+
+function _index_bounds(n, i::AbstractUnitRange)
+    isempty(i) && return (0, 1, 0)
+    return 1 ≤ first(i) && last(i) ≤ n ? (first(i) - 1, 1, length(i)) : nothing
+end
+
+function _index_bounds(n, i::StepRange)
+    step(i) ≤ 0 && throw(ArgumentError("subviews only support ranges with positive steps, got: $i"))
+    isempty(i) && return (0, step(i), 0)
+    return 1 ≤ first(i) && last(i) ≤ n ? (first(i) - 1, step(i), length(i)) : nothing
+end
+
+
+# The bounds of all dimensions of `v` selected by `indexes`, as expected by `subview_from_bounds` in
+# 'subviews.cpp'. Missing indexes are completed with `:`.
+function _subview_bounds(v::View{T, D}, indexes::Tuple) where {T, D}
+    length(indexes) > D && throw(BoundsError(v, indexes))
+    dims_bounds = ntuple(d -> _index_bounds(size(v, d), d ≤ length(indexes) ? indexes[d] : Colon()), Val(D))
+    any(isnothing, dims_bounds) && throw(BoundsError(v, indexes))
+    bounds = Vector{Int64}(undef, 3 * D)
+    for d in 1:D
+        bounds[3*d-2], bounds[3*d-1], bounds[3*d] = dims_bounds[d]
+    end
+    return bounds
 end
 
 
@@ -622,7 +977,10 @@ function _get_subview_dim_and_layout(src_rank, src_layout, indexes_type)
     rank = sum(is_range)
     rank == 0 && return 0, src_layout
 
-    keep_layout = rank <= 2 &&
+    # The steps of `StepRange`s are folded into the strides
+    has_steps = any(t -> t <: StepRange, indexes_type.parameters)
+
+    keep_layout = rank <= 2 && !has_steps &&
         ((src_layout === LayoutLeft  && is_range[1]       ) ||
          (src_layout === LayoutRight && is_range[src_rank]))
 
@@ -630,25 +988,28 @@ function _get_subview_dim_and_layout(src_rank, src_layout, indexes_type)
 end
 
 
-function subview(
-    v::View{T, D, L, S},
-    indexes::Tuple{Vararg{Union{Int, Colon, AbstractUnitRange}}}
-) where {T, D, L, S}
+const SubviewIndex = Union{Int, Colon, AbstractUnitRange, StepRange{Int, Int}}
+
+
+function subview(v::View{T, D, L, S}, indexes::Tuple{Vararg{SubviewIndex}}) where {T, D, L, S}
     subview_dim, subview_layout = _get_subview_dim_and_layout(D, L, typeof(indexes))
     sub_v = subview(v, indexes, Val{subview_dim}, subview_layout)
 
-    # Explicit lock to avoid locking twice on `haskey` then `setindex!`
-    lock(TRACKED_VIEWS) do
-        if haskey(TRACKED_VIEWS, v)
-            push!(TRACKED_VIEWS, sub_v)
-        end
+    # `v` and `sub_v` may be in different shards of `TRACKED_VIEWS`, but `v` cannot be untracked
+    # while it is alive
+    if haskey(TRACKED_VIEWS, v)
+        push!(TRACKED_VIEWS, sub_v)
     end
 
+    # The data of `v` might be owned by another object, rooted by `v` (e.g. `View(array)`), which
+    # must outlive `sub_v` as well. Otherwise the Kokkos allocation is reference counted.
+    _has_julia_owner(v) && _root_owner!(sub_v, v)
+
     return sub_v
 end
 
 
-subview(v::View, indexes::Vararg{Union{Int, Colon, AbstractUnitRange}}) = subview(v, indexes)
+subview(v::View, indexes::Vararg{SubviewIndex}) = subview(v, indexes)
 
 
 # === Constructors ===
@@ -724,19 +1085,26 @@ If `track == true`, the view will be added to the global dict of views (as a `We
 used when [`finalize`](@ref) is called in order to properly free all views. This can have a little
 overhead, hence the possibility to disable it.
 
+If the view pool of `MemSpace` is enabled (see [`enable_view_pool`](@ref)), the view may be
+allocated from the pool.
+
 See [the Kokkos documentation about `Kokkos::view_alloc()`](https://kokkos.github.io/kokkos-core-wiki/API/core/view/view_alloc.html)
 for more info.
 
 This function relies on [Dynamic Compilation](@ref).
 """
-function View{T, D, L, S}(dims::Dims{D};
+function View{T, D, L, S, MT}(dims::Dims{D};
     mem_space = nothing,
     layout = nothing,
     label = "",
     zero_fill = true,
     dim_pad = false,
     track = true
-) where {T, D, L, S}
+) where {T, D, L, S, MT}
+    if has_memory_trait(MT, Unmanaged)
+        error("cannot allocate a view with `Unmanaged` memory traits, use `view_wrap` instead")
+    end
+
     if isnothing(mem_space)
         # ok
     elseif mem_space isa DataType
@@ -762,7 +1130,12 @@ function View{T, D, L, S}(dims::Dims{D};
         error("the `View` constructor with a `LayoutStride` requires a instance of the layout")
     end
 
-    view = alloc_view(View{T, D, L, S}, dims, mem_space, layout, label, zero_fill, dim_pad)
+    pool = (isnothing(mem_space) && !dim_pad && L !== LayoutStride) ? _view_pool(S) : nothing
+    if !isnothing(pool)
+        view = _alloc_pooled_view(pool, View{T, D, L, S, MT}, dims, layout, label, zero_fill)
+    else
+        view = alloc_view(View{T, D, L, S, MT}, dims, mem_space, layout, label, zero_fill, dim_pad)
+    end
 
     if track
         push!(TRACKED_VIEWS, view)
@@ -771,6 +1144,14 @@ function View{T, D, L, S}(dims::Dims{D};
     return view
 end
 
+View{T, D, L, S, MT}(::UndefInitializer, dims::Dims{D}; kwargs...) where {T, D, L, S, MT} =
+    View{T, D, L, S, MT}(dims; kwargs..., zero_fill=false)
+
+
+# View{T, D, L, S} to View{T, D, L, S, MemoryTraits{0}}
+View{T, D, L, S}(dims::Dims{D}; kwargs...) where {T, D, L, S} =
+    View{T, D, L, S, MemoryTraits{0}}(dims; kwargs...)
+
 View{T, D, L, S}(::UndefInitializer, dims::Dims{D}; kwargs...) where {T, D, L, S} =
     View{T, D, L, S}(dims; kwargs..., zero_fill=false)
 
@@ -805,6 +1186,7 @@ View{T, D}(::UndefInitializer, dims::Dims{D}; kwargs...) where {T, D} =
 
 # Int... to Dims{D}
 """
+    View{T, D, L, S, MT}(undef, dims; kwargs...)
     View{T, D, L, S}(undef, dims; kwargs...)
     View{T, D, L}(undef, dims; kwargs...)
     View{T, D}(undef, dims; kwargs...)
@@ -814,6 +1196,8 @@ Construct an N-dimensional `View{T}`, without initialization of its elements.
 
 Strictly equivalent to passing `zero_fill=false` to the `kwargs`.
 """
+View{T, D, L, S, MT}(::UndefInitializer, dims::Integer...; kwargs...) where {T, D, L, S, MT} =
+    View{T, D, L, S, MT}(convert(Tuple{Vararg{Int}}, dims); kwargs..., zero_fill=false)
 View{T, D, L, S}(::UndefInitializer, dims::Integer...; kwargs...) where {T, D, L, S} =
     View{T, D, L, S}(convert(Tuple{Vararg{Int}}, dims); kwargs..., zero_fill=false)
 View{T, D, L}(::UndefInitializer, dims::Integer...; kwargs...) where {T, D, L} =
@@ -822,6 +1206,8 @@ View{T, D}(::UndefInitializer, dims::Integer...; kwargs...) where {T, D} =
     View{T, D}(convert(Tuple{Vararg{Int}}, dims); kwargs..., zero_fill=false)
 
 # Int... to Dims{D} but without the UndefInitializer
+View{T, D, L, S, MT}(dims::Integer...; kwargs...) where {T, D, L, S, MT} =
+    View{T, D, L, S, MT}(convert(Tuple{Vararg{Int}}, dims); kwargs...)
 View{T, D, L, S}(dims::Integer...; kwargs...) where {T, D, L, S} =
     View{T, D, L, S}(convert(Tuple{Vararg{Int}}, dims); kwargs...)
 View{T, D, L}(dims::Integer...; kwargs...) where {T, D, L} =
@@ -840,6 +1226,8 @@ View{T}(dims::Integer...; kwargs...) where {T} =
     View{T}(convert(Tuple{Vararg{Int}}, dims); kwargs...)
 
 # Empty constructors
+View{T, D, L, S, MT}(; kwargs...) where {T, D, L, S, MT} =
+    View{T, D, L, S, MT}(ntuple(Returns(0), D); kwargs..., zero_fill=false)
 View{T, D, L, S}(; kwargs...) where {T, D, L, S} =
     View{T, D, L, S}(ntuple(Returns(0), D); kwargs..., zero_fill=false)
 View{T, D, L}(; kwargs...) where {T, D, L} =
@@ -857,6 +1245,7 @@ View{T}(; kwargs...) where {T} =
     view_wrap(array::DenseArray{T, D})
     view_wrap(array::SubArray{T, D})
     view_wrap(::Type{View{T, D, L, S}}, d::NTuple{D, Int}, p::Ptr{T}; layout = nothing)
+    view_wrap(::Type{View{T, D, L, S, MT}}, d::NTuple{D, Int}, p::Ptr{T}; layout = nothing)
 
 Construct a new [`View`](@ref) from the data of a Julia-allocated array (or from any valid array or
 pointer).
@@ -868,6 +1257,9 @@ layout `L` is [`LayoutLeft`](@ref) for `DenseArray` and [`LayoutStride`](@ref) f
 If `L` is `LayoutStride`, then the kwarg `layout` should be an instance of a `LayoutStride` which
 specifies the stride of each dimension.
 
+The memory traits `MT` default to `MemoryTraits{0}`. Views with the [`Unmanaged`](@ref) trait can
+only be created with `view_wrap`, and have no reference counting on the C++ side.
+
 !!! warning
 
     Julia arrays have a column-major layout by default. This correspond to a [`LayoutLeft`](@ref),
@@ -879,7 +1271,7 @@ specifies the stride of each dimension.
 
     The returned view does not hold a reference to the original array.
     It is the responsibility of the user to make sure the original array is kept alive as long as
-    the view should be accessed.
+    the view should be accessed. [`View(array)`](@ref View(::DenseArray)) does it automatically.
 
 !!! note
 
@@ -889,7 +1281,7 @@ specifies the stride of each dimension.
 
 This function relies on [Dynamic Compilation](@ref).
 """
-function view_wrap(view_t::Type{View{T, D, L, S}}, d::Dims{D}, layout, p::Ptr{T}) where {T, D, L, S}
+function view_wrap(view_t::Type{View{T, D, L, S, MT}}, d::Dims{D}, layout, p::Ptr{T}) where {T, D, L, S, MT}
     @nospecialize view_t d layout p
     return DynamicCompilation.@compile_and_call(view_wrap, (view_t, d, layout, p), begin
         compile_view(view_t; for_function=view_wrap, no_error=true) 
@@ -897,9 +1289,16 @@ function view_wrap(view_t::Type{View{T, D, L, S}}, d::Dims{D}, layout, p::Ptr{T}
 end
 
 
+view_wrap(::Type{View{T, D, L, S}}, d::Dims{D}, layout, p::Ptr{T}) where {T, D, L, S} =
+    view_wrap(View{T, D, L, S, MemoryTraits{0}}, d, layout, p)
+
+view_wrap(::Type{View{T, D, L, S, MT}}, d::Dims{D}, p::Ptr{T}; layout=nothing) where {T, D, L, S, MT} =
+    view_wrap(View{T, D, L, S, MT}, d, layout, p)
 view_wrap(::Type{View{T, D, L, S}}, d::Dims{D}, p::Ptr{T}; layout=nothing) where {T, D, L, S} =
     view_wrap(View{T, D, L, S}, d, layout, p)
 
+view_wrap(::Type{View{T, D, L, S, MT}}, a::AbstractArray{T, D}; kwargs...) where {T, D, L, S, MT} =
+    view_wrap(View{T, D, L, S, MT}, size(a), pointer(a); kwargs...)
 view_wrap(::Type{View{T, D, L, S}}, a::AbstractArray{T, D}; kwargs...) where {T, D, L, S} =
     view_wrap(View{T, D, L, S}, size(a), pointer(a); kwargs...)
 
@@ -922,21 +1321,165 @@ function view_wrap(::Type{View{T, D}}, a::SubArray{T, D}) where {T, D}
 end
 
 
+# Keep `owner` alive as long as `obj` is: the finalizer of `obj` holds a reference to `owner`
+function _root_owner!(obj, owner)
+    finalizer(_ -> Base.donotdelete(owner), obj)
+    obj isa View && push!(JULIA_OWNED_VIEWS, obj)
+    return obj
+end
+
+_has_julia_owner(v::View) = haskey(JULIA_OWNED_VIEWS, v)
+
+
+"""
+    View(array::DenseArray{T, D})
+    View{T, D}(array::DenseArray{T, D})
+
+Alias the data of the Julia-allocated `array` with a new `View{T, D, LayoutLeft, HostSpace}`.
+No copy is made.
+
+Unlike [`view_wrap`](@ref), the returned view holds a reference to `array`: `array` is kept alive
+by the GC as long as the view, or any of its [`subview`](@ref)s, is.
+
+See also [`unsafe_wrap(Array, v::View)`](@ref Base.unsafe_wrap(::Type{Array}, ::View)).
+"""
+function View{T, D}(array::DenseArray{T, D}) where {T, D}
+    v = view_wrap(View{T, D}, array)
+    _root_owner!(v, array)
+    return v
+end
+
+View(array::DenseArray{T, D}) where {T, D} = View{T, D}(array)
+
+
+"""
+    unsafe_wrap(Array, v::View{T, D})
+    unsafe_wrap(Array{T}, v::View{T, D})
+    unsafe_wrap(Array{T, D}, v::View{T, D})
+
+Alias the data of `v` with a new `Array{T, D}`. No copy is made.
+
+The view must be accessible from the host, and have the same (column-major) strides as an
+`Array`, which is the case of contiguous views with a [`LayoutLeft`](@ref), or of any contiguous 1D
+view.
+
+The returned array holds its own reference to the allocation of `v`: the data stays valid as long as
+the array is alive, even if `v` is no longer referenced or is finalized. If the data of `v` is owned
+by a Julia object (e.g. the array of [`View(array)`](@ref View(::DenseArray))), `v` is kept alive
+instead.
+
+Unlike `Array(v)`, which copies the data of `v`.
+
+!!! warning
+
+    The array must not be used after [`Kokkos.finalize`](@ref finalize), which frees all
+    allocations.
+"""
+function Base.unsafe_wrap(
+    ::Union{Type{Array}, Type{Array{T}}, Type{Array{T, D}}}, v::View{T, D, L, S}
+) where {T, D, L, S}
+    if !accessible(S)
+        error("wrapping a Kokkos view into an `Array` is only possible for host-accessible memory \
+               spaces, got: $S")
+    elseif strides(v) != Base.size_to_strides(1, size(v)...)
+        error("only views with column-major strides can be wrapped into an `Array` \
+               (layout: $L, size: $(size(v)), strides: $(strides(v)))")
+    end
+
+    array = Base.unsafe_wrap(Array, pointer(v), size(v); own=false)
+    _root_owner!(array, _has_julia_owner(v) ? v : _untracked_copy(v))
+    return array
+end
+
+
 # === Array interface ===
 
 Base.IndexStyle(::Type{<:View}) = IndexCartesian()
 
-@inline Base.size(v::View) = _get_dims(v)
+@inline Base.size(v::View) = _metadata(v).dims
 
 @inline to_c_index(I::Vararg{Int, D}) where {D} = convert.(Idx, I .- 1)
-Base.@propagate_inbounds elem_ptr(v::View{T, D}, I::Vararg{Int, D}) where {T, D} =
-    (@boundscheck checkbounds(v, I...); _get_ptr(v, to_c_index(I...)...))
 
-Base.@propagate_inbounds Base.getindex(v::View{T, D}, I::Vararg{Int, D}) where {T, D} =
-    elem_ptr(v, I...)[]
+@noinline function _inaccessible_elem_ptr(v::View, I)
+    # Throws the appropriate error
+    _get_ptr(v, to_c_index(I...)...)
+    error("expected the view to be inaccessible from the host")
+end
 
-Base.@propagate_inbounds Base.setindex!(v::View{T, D}, val, I::Vararg{Int, D}) where {T, D} =
-    (elem_ptr(v, I...)[] = convert(T, val))
+Base.@propagate_inbounds function elem_ptr(v::View{T, D}, I::Vararg{Int, D}) where {T, D}
+    @boundscheck checkbounds(v, I...)
+    meta = _metadata(v)
+    meta.host_accessible || _inaccessible_elem_ptr(v, I)
+    offset = sum(map((i, s) -> (i - 1) * s, I, meta.strides); init=0)
+    return meta.data + offset * sizeof(T)
+end
+
+# Element types for which views with the `Atomic` trait are accessed with atomic loads and stores
+const AtomicElemTypes = Union{Bool, Base.BitInteger, Float16, Float32, Float64}
+
+@inline _atomic_access(::Type{<:View{T, D, L, S, MT}}) where {T, D, L, S, MT} =
+    T <: AtomicElemTypes && has_memory_trait(MT, Atomic)
+
+Base.@propagate_inbounds function Base.getindex(v::View{T, D}, I::Vararg{Int, D}) where {T, D}
+    ptr = elem_ptr(v, I...)
+    _atomic_access(typeof(v)) && return Core.Intrinsics.atomic_pointerref(ptr, :sequentially_consistent)::T
+    return unsafe_load(ptr)
+end
+
+Base.@propagate_inbounds function Base.setindex!(v::View{T, D}, val, I::Vararg{Int, D}) where {T, D}
+    ptr = elem_ptr(v, I...)
+    if _atomic_access(typeof(v))
+        Core.Intrinsics.atomic_pointerset(ptr, convert(T, val), :sequentially_consistent)
+    else
+        unsafe_store!(ptr, convert(T, val))
+    end
+    return v
+end
+
+# Region accesses: the whole region is copied to/from an `Array` in a single call, using a kernel on
+# the default host execution space.
+# The region methods only apply to indexes with at least one range or `Colon`: all-`Integer` indexes
+# go through the scalar methods above. Since this cannot be expressed with a single `Vararg`, there
+# is one method for each position of the first range, for each dimension supported by Kokkos.
+const RegionIndex = Union{Integer, AbstractUnitRange, Colon}
+const RegionRange = Union{AbstractUnitRange, Colon}
+
+_region_start(ranges::Tuple) = map(r -> Int(first(r)) - 1, ranges)
+_region_count(ranges::Tuple) = map(r -> Int(length(r)), ranges)
+
+Base.@propagate_inbounds function _region_getindex(v::View{T, D}, I::NTuple{D, RegionIndex}) where {T, D}
+    ranges = to_indices(v, I)
+    @boundscheck checkbounds(v, ranges...)
+    dest = Array{T}(undef, Base.index_shape(ranges...))
+    GC.@preserve dest _copy_to_array(v, _region_start(ranges), _region_count(ranges), pointer(dest))
+    return dest
+end
+
+Base.@propagate_inbounds function _region_setindex!(
+    v::View{T, D}, src::AbstractArray, I::NTuple{D, RegionIndex}
+) where {T, D}
+    ranges = to_indices(v, I)
+    @boundscheck checkbounds(v, ranges...)
+    count = _region_count(ranges)
+    Base.setindex_shape_check(src, count...)
+    # Singleton dimensions aside, `src` has the same shape as the region, therefore its elements are
+    # in the expected column-major order once converted to an `Array`.
+    src_array = src isa Array{T} ? src : Array{T}(src)
+    GC.@preserve src_array _copy_from_array(v, _region_start(ranges), count, pointer(src_array))
+    return v
+end
+
+for D in 1:8, first_range in 1:D
+    idx = [Symbol(:i, d) for d in 1:D]
+    args = [:($(idx[d])::$(d < first_range ? :Integer : d == first_range ? :RegionRange : :RegionIndex))
+            for d in 1:D]
+    @eval begin
+        Base.@propagate_inbounds Base.getindex(v::View{T, $D}, $(args...)) where {T} =
+            _region_getindex(v, ($(idx...),))
+        Base.@propagate_inbounds Base.setindex!(v::View{T, $D}, src::AbstractArray, $(args...)) where {T} =
+            _region_setindex!(v, src, ($(idx...),))
+    end
+end
 
 Base.similar(a::View{T, D, L, M}) where {T, D, L, M} =
     View{T, D, L, main_space_type(M)}(size(a);
@@ -955,6 +1498,22 @@ Base.similar(::View{<:Any, <:Any, L, M}, ::Type{T}, dims::Dims{D}) where {T, D,
 Base.copyto!(dest::View{DT, Dim, DL, DM}, src::View{ST, Dim, SL, SM}) where {DT, ST, DL, SL, DM, SM, Dim} =
     deep_copy(dest, src)
 
+function Base.copyto!(dest::Array{T, D}, src::View{T, D}) where {T, D}
+    if size(dest) != size(src)
+        return invoke(copyto!, Tuple{AbstractArray, AbstractArray}, dest, src)
+    end
+    GC.@preserve dest _copy_to_array(src, ntuple(Returns(0), D), size(src), pointer(dest))
+    return dest
+end
+
+function Base.copyto!(dest::View{T, D}, src::Array{T, D}) where {T, D}
+    if size(dest) != size(src)
+        return invoke(copyto!, Tuple{AbstractArray, AbstractArray}, dest, src)
+    end
+    GC.@preserve src _copy_from_array(dest, ntuple(Returns(0), D), size(dest), pointer(src))
+    return dest
+end
+
 
 Base.sizeof(v::View) = Int(memory_span(v))
 
@@ -962,7 +1521,7 @@ Base.sizeof(v::View) = Int(memory_span(v))
 # === Pointer conversion ===
 
 # Pointer to the array data
-Base.pointer(v::V) where {T, V <: View{T}} = Ptr{T}(view_data(v).cpp_object)
+Base.pointer(v::V) where {T, V <: View{T}} = _metadata(v).data
 
 
 # Pointer to the view object, for ccalls:
@@ -971,25 +1530,38 @@ Base.pointer(v::V) where {T, V <: View{T}} = Ptr{T}(view_data(v).cpp_object)
 Base.cconvert(::Type{Ref{V}}, v::V) where {V <: View} = Ptr{Nothing}(v.cpp_object)
 
 # For the case `my_func(v) = ccall(my_c_func, (Ref{View{...}},), v)`
-function Base.cconvert(::Type{Ref{View{T, D, L, S}}}, v::View) where {T, D, L, S}
-    impl_view_t = impl_view_type(View{T, D, L, S})
+function Base.cconvert(::Type{Ref{V}}, v::View) where {V <: View}
+    impl_view_t = impl_view_type(V)
     if v isa impl_view_t
         return Ptr{Nothing}(v.cpp_object)
     else
-        error("Expected a view of type `$impl_view_t` (aka `View{$T, $D, $L, $S}`), got: `$(typeof(v))`")
+        error("Expected a view of type `$impl_view_t` (aka `$(main_view_type(V))`), got: `$(typeof(v))`")
     end
 end
 
 
 # === Strided Array interface ===
 
-Base.strides(v::View) = _get_strides(v)
+Base.strides(v::View) = _metadata(v).strides
 
 Base.unsafe_convert(::Type{Ptr{T}}, v::V) where {T, V <: View{T}} = pointer(v)
 
 Base.elsize(::Type{<:View{T}}) where {T} = sizeof(T)
 
 
+# === Parallel algorithms ===
+
+# Execution space used by default by the functions relying on Kokkos kernels
+_default_exec_space(v::View) = execution_space(memory_space(v))()
+
+include("reductions.jl")
+include("algorithms.jl")
+include("sort.jl")
+include("broadcast.jl")
+include("kernels.jl")
+include("view_pool.jl")
+
+
 # === Printing ===
 
 function Base.summary(io::IO, v::View)
@@ -1,3 +1,26 @@
+# Number of shards of a `WeakViewDict`, a power of 2
+const _WVD_SHARDS = 32
+
+# Minimum number of finalized views in a shard before cleaning it up
+const _WVD_CLEANUP_BATCH = 32
+
+
+# A part of a `WeakViewDict`, with its own lock.
+# `dead` counts the views of the shard which got finalized since the last cleanup. It is updated
+# from finalizers, which cannot take locks.
+mutable struct WeakViewDictShard
+    d::Dict{Ptr{Cvoid}, WeakRef}
+    lock::ReentrantLock
+    finalizer::Function
+    @atomic dead::Int
+
+    function WeakViewDictShard()
+        shard = new(Dict{Ptr{Cvoid}, WeakRef}(), ReentrantLock(), identity, 0)
+        shard.finalizer = _ -> (@atomic shard.dead += 1)
+        return shard
+    end
+end
+
 
 # Very similar to `Base.WeakKeyDict`, but its keys are `Ptr{Cvoid}` and values are `WeakRef`s to `View`
 # objects. It is used to track view objects.
@@ -5,47 +28,76 @@
 # impossible when the view is inaccessible. Any overload of `Base.hash` would go against what the
 # function operates on any `AbstractArray`. Therefore implementing a `WeakKeyDict` with `WeakRef`
 # values was the simplest path.
-mutable struct WeakViewDict <: AbstractDict{Ptr{Cvoid}, View}
-    d::Dict{Ptr{Cvoid}, WeakRef}
-    lock::ReentrantLock
-    finalizer::Function
-    dirty::Bool
+# Views are distributed in shards by their pointer, each with its own lock, to not serialize the
+# allocation of views from many threads. Locking the whole dict locks all shards.
+struct WeakViewDict <: AbstractDict{Ptr{Cvoid}, View}
+    shards::Vector{WeakViewDictShard}
 
-    function WeakViewDict()
-        wvd = new(Dict{Ptr{Cvoid}, WeakRef}(), ReentrantLock(), identity, false)
-        wvd.finalizer = _ -> (wvd.dirty = true)
-        return wvd
-    end
+    WeakViewDict() = new([WeakViewDictShard() for _ in 1:_WVD_SHARDS])
 end
 
 
 Base.IteratorSize(::Type{WeakViewDict}) = Base.SizeUnknown()
 
-Base.islocked(wvd::WeakViewDict) = islocked(wvd.lock)
-Base.lock(wvd::WeakViewDict) = lock(wvd.lock)
-Base.unlock(wvd::WeakViewDict) = unlock(wvd.lock)
-Base.lock(f, wvd::WeakViewDict) = lock(f, wvd.lock)
-Base.trylock(f, wvd::WeakViewDict) = trylock(f, wvd.lock)
+_shard(wvd::WeakViewDict, key::Ptr{Cvoid}) =
+    @inbounds wvd.shards[(hash(key) & (_WVD_SHARDS - 1)) + 1]
+
+Base.islocked(wvd::WeakViewDict) = any(shard -> islocked(shard.lock), wvd.shards)
+
+function Base.lock(wvd::WeakViewDict)
+    # Always in the same order, to avoid deadlocks
+    foreach(shard -> lock(shard.lock), wvd.shards)
+end
+
+function Base.unlock(wvd::WeakViewDict)
+    foreach(shard -> unlock(shard.lock), Iterators.reverse(wvd.shards))
+end
+
+function Base.lock(f, wvd::WeakViewDict)
+    lock(wvd)
+    try
+        return f()
+    finally
+        unlock(wvd)
+    end
+end
 
+function Base.trylock(f, wvd::WeakViewDict)
+    for (i, shard) in enumerate(wvd.shards)
+        if !trylock(shard.lock)
+            foreach(s -> unlock(s.lock), wvd.shards[i-1:-1:1])
+            return false
+        end
+    end
+    try
+        return f()
+    finally
+        unlock(wvd)
+    end
+end
 
-function _cleanup_locked(wvd::WeakViewDict)
-    wvd.dirty || return
-    wvd.dirty = false
-    idx = Base.skip_deleted_floor!(wvd.d)
+
+function _cleanup_locked(shard::WeakViewDictShard)
+    # Cleanup in batches, proportionally to the size of the shard, for an amortized constant cost
+    dead = @atomic shard.dead
+    dead < max(_WVD_CLEANUP_BATCH, length(shard.d) ÷ 4) && return
+    @atomic shard.dead -= dead
+    idx = Base.skip_deleted_floor!(shard.d)
     while idx != 0
-        if wvd.d.vals[idx].value === nothing
-            Base._delete!(wvd.d, idx)
+        if shard.d.vals[idx].value === nothing
+            Base._delete!(shard.d, idx)
         end
-        idx = Base.skip_deleted(wvd.d, idx + 1)
+        idx = Base.skip_deleted(shard.d, idx + 1)
     end
 end
 
 
 function Base.setindex!(wvd::WeakViewDict, view::View, key::Ptr{Cvoid})
-    lock(wvd) do 
-        _cleanup_locked(wvd)
-        finalizer(wvd.finalizer, view)
-        wvd.d[key] = WeakRef(view)
+    shard = _shard(wvd, key)
+    lock(shard.lock) do
+        _cleanup_locked(shard)
+        finalizer(shard.finalizer, view)
+        shard.d[key] = WeakRef(view)
     end
     return wvd
 end
@@ -55,25 +107,29 @@ Base.push!(wvd::WeakViewDict, view::View) = setindex!(wvd, view, view.cpp_object
 
 function Base.empty!(wvd::WeakViewDict)
     lock(wvd) do
-        empty!(wvd.d)
+        for shard in wvd.shards
+            empty!(shard.d)
+            @atomic shard.dead = 0
+        end
     end
     return wvd
 end
 
 
 function Base.haskey(wvd::WeakViewDict, ptr::Ptr{Cvoid})
-    lock(wvd) do
-        return haskey(wvd.d, ptr)
+    shard = _shard(wvd, ptr)
+    lock(shard.lock) do
+        return haskey(shard.d, ptr)
     end
 end
 
 Base.haskey(wvd::WeakViewDict, view::View) = haskey(wvd, view.cpp_object)
 
 
-function Base.iterate(wvd::WeakViewDict, state...)
-    lock(wvd) do
+function _iterate_shard(shard::WeakViewDictShard, state...)
+    lock(shard.lock) do
         while true
-            s = iterate(wvd.d, state...)
+            s = iterate(shard.d, state...)
             s === nothing && return nothing
             kv, state = s
             v = kv[2].value
@@ -83,3 +139,15 @@ function Base.iterate(wvd::WeakViewDict, state...)
         end
     end
 end
+
+
+function Base.iterate(wvd::WeakViewDict, state=(1,))
+    shard_idx, shard_state... = state
+    while shard_idx <= length(wvd.shards)
+        s = _iterate_shard(wvd.shards[shard_idx], shard_state...)
+        s !== nothing && return (s[1], (shard_idx, s[2]))
+        shard_idx += 1
+        shard_state = ()
+    end
+    return nothing
+end
@@ -47,6 +47,167 @@ end
 end
 
 
+@testset "Compiled libs cache" begin
+    config_id = Kokkos.DynamicCompilation.build_config_id()
+    @test occursin(r"^[0-9a-f]{40}$", config_id)
+    @test Kokkos.DynamicCompilation.build_config_id() === config_id
+
+    libs_dir = Kokkos.Wrapper.get_kokkos_func_libs_dir()
+    @test all(lib -> occursin(r"-[0-9a-f]{20}\.", lib), readdir(libs_dir))
+
+    @test Kokkos.DynamicCompilation.evict_libs(; max_size=nothing) == 0
+
+    # Eviction in a separate cache, to keep the libraries of the real one
+    mktempdir() do tmp_libs_dir
+        ext = Kokkos.DynamicCompilation.SHARED_LIB_EXT
+        libs = [joinpath(tmp_libs_dir, "lib_$i$ext") for i in 1:4]
+        for lib in libs
+            write(lib, zeros(UInt8, 100))
+            sleep(0.01)  # Distinct modification times, from the least to the most recently used
+        end
+
+        # Loaded libs are never removed
+        loaded_libs = Kokkos.DynamicCompilation.LOADED_FUNCTION_LIBS
+        lock(() -> loaded_libs["__test_loaded_lib"] = Kokkos.CLibrary(libs[1], libs[1], C_NULL, Dict()),
+            Kokkos.DynamicCompilation.LOAD_LIB_LOCK)
+        try
+            @test Kokkos.DynamicCompilation.evict_libs(; max_size=400, libs_dir=tmp_libs_dir) == 0
+            @test Kokkos.DynamicCompilation.evict_libs(; max_size=250, libs_dir=tmp_libs_dir) == 2
+            @test isfile.(libs) == [true, false, false, true]
+            @test Kokkos.DynamicCompilation.evict_libs(; max_size=0, libs_dir=tmp_libs_dir) == 1
+            @test readdir(tmp_libs_dir; join=true) == [libs[1]]
+        finally
+            lock(() -> delete!(loaded_libs, "__test_loaded_lib"), Kokkos.DynamicCompilation.LOAD_LIB_LOCK)
+        end
+    end
+end
+
+
+
+@testset "Kernel profiler" begin
+    @test !Kokkos.kernel_profiler_enabled()
+    Kokkos.reset_kernel_profile()
+    @test isempty(Kokkos.kernel_profile())
+
+    Kokkos.enable_kernel_profiler()
+    @test Kokkos.kernel_profiler_enabled()
+    Kokkos.enable_kernel_profiler()  # No-op
+
+    v1 = Kokkos.View{Float64}(undef, 100; label="profiled_v1")
+    v2 = Kokkos.View{Float64}(undef, 100; label="profiled_v2")
+    Kokkos.deep_copy(v1, v2)
+    Kokkos.fence("Kokkos.jl::test_fence")
+    Kokkos.fence("Kokkos.jl::test_fence")
+
+    Kokkos.disable_kernel_profiler()
+    @test !Kokkos.kernel_profiler_enabled()
+    Kokkos.fence("Kokkos.jl::test_fence")  # Not measured
+
+    profile = Kokkos.kernel_profile()
+    @test issorted(profile; by=row -> row.total, rev=true)
+
+    fence_row = only(filter(row -> row.label == "Kokkos.jl::test_fence", profile))
+    @test fence_row.kind === :fence
+    @test fence_row.count == 2
+    @test 0 ≤ fence_row.min ≤ fence_row.mean ≤ fence_row.max ≤ fence_row.total
+
+    copy_row = only(filter(row -> row.label == "profiled_v1 <- profiled_v2", profile))
+    @test copy_row.kind === :deep_copy
+    @test copy_row.count == 1
+
+    Kokkos.reset_kernel_profile()
+    @test isempty(Kokkos.kernel_profile())
+end
+
+
+@testset "Profiling regions" begin
+    # No tools are loaded in the tests
+    @test !Kokkos.profile_library_loaded()
+    @test !Kokkos._TOOLS_LOADED[]
+    @test (@kokkos_region "Kokkos.jl::test_region" 1 + 1) == 2
+
+    Kokkos.enable_kernel_profiler()
+    @test Kokkos.profile_library_loaded()
+    @test Kokkos._TOOLS_LOADED[]
+
+    @test (@kokkos_region "Kokkos.jl::test_region" 1 + 1) == 2
+    @test_throws r"oops" @kokkos_region "Kokkos.jl::test_region" error("oops")
+    Kokkos.push_region("Kokkos.jl::test_outer_region")
+    Kokkos.mark_event("Kokkos.jl::test_event")
+    Kokkos.pop_region()
+
+    section = Kokkos.create_profile_section("Kokkos.jl::test_section")
+    @test section isa UInt32
+    for _ in 1:3
+        Kokkos.start_section(section)
+        Kokkos.stop_section(section)
+    end
+    Kokkos.destroy_profile_section(section)
+
+    Kokkos.disable_kernel_profiler()
+    @test !Kokkos._TOOLS_LOADED[]
+    Kokkos.reset_kernel_profile()
+end
+
+
+@testset "Memory telemetry" begin
+    @test !Kokkos.memory_telemetry_enabled()
+    Kokkos.enable_memory_telemetry()
+    @test Kokkos.memory_telemetry_enabled()
+    @test Kokkos._TOOLS_LOADED[]
+
+    host_space(telemetry) = only(filter(s -> s.space === Kokkos.HostSpace, telemetry.spaces))
+
+    before = host_space(Kokkos.memory_telemetry())
+    v = Kokkos.View{Float64}(undef, 1000; label="telemetry_v", mem_space=Kokkos.HostSpace)
+    telemetry = Kokkos.memory_telemetry()
+    @test length(telemetry.spaces) == length(Kokkos.ENABLED_MEM_SPACES)
+
+    during = host_space(telemetry)
+    @test during.allocations == before.allocations + 1
+    @test during.live_bytes ≥ before.live_bytes + sizeof(v)
+    @test during.high_water_bytes ≥ during.live_bytes
+    v_label = only(filter(l -> l.label == "telemetry_v", during.labels))
+    @test v_label.live_bytes ≥ sizeof(v)
+    @test v_label.live_allocations == 1
+
+    Base.finalize(v)
+    after = host_space(Kokkos.memory_telemetry())
+    @test after.deallocations == before.deallocations + 1
+    @test after.live_bytes == before.live_bytes
+    @test after.high_water_bytes == during.high_water_bytes
+    @test !any(l -> l.label == "telemetry_v", after.labels)
+
+    Kokkos.reset_memory_high_water()
+    @test host_space(Kokkos.memory_telemetry()).high_water_bytes == after.live_bytes
+
+    rss, free, total = Kokkos.host_memory_info()
+    @test 0 < free ≤ total
+    Sys.islinux() && @test 0 < rss
+    @test telemetry.host.total == total
+    if TEST_CUDA || TEST_HIP
+        @test telemetry.device.free ≤ telemetry.device.total
+    else
+        @test telemetry.device === nothing
+    end
+
+    Kokkos.disable_memory_telemetry()
+    @test !Kokkos.memory_telemetry_enabled()
+    @test !Kokkos._TOOLS_LOADED[]
+end
+
+
+@testset "Sub-libraries PCH" begin
+    pch_options = Kokkos.DynamicCompilation.sub_libraries_pch_options()
+    if Kokkos.Cuda in Kokkos.ENABLED_EXEC_SPACES || Kokkos.HIP in Kokkos.ENABLED_EXEC_SPACES
+        @test isempty(pch_options)
+    else
+        @test length(pch_options) == 2
+        pch_path = last(split(first(pch_options), '='; limit=2))
+        @test isfile(pch_path)
+    end
+end
+
 Kokkos.DynamicCompilation.clean_libs()
 @test isempty(readdir(Kokkos.Wrapper.get_kokkos_func_libs_dir()))
 
@@ -1,6 +1,7 @@
 
 using Test
 using Logging
+using LinearAlgebra
 using Preferences
 using Kokkos
 
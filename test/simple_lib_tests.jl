@@ -59,6 +59,7 @@ function call_create_view_by_reference(lib, nx)
         (Ref{View{Float64, 1, array_layout(Kokkos.DEFAULT_DEVICE_SPACE), Kokkos.DEFAULT_DEVICE_MEM_SPACE}}, Cint),
         v_ref, nx
     )
+    Kokkos.update_metadata!(v_ref)  # The view was assigned to in C++
     return v_ref
 end
 
@@ -73,6 +74,7 @@ end
             (Ref{$view_t}, Cint, Cint),
             v_ref, nx, ny
         )
+        Kokkos.update_metadata!(v_ref)  # The view was assigned to in C++
         return v_ref
     end 
 end
@@ -79,6 +79,20 @@ host_space = Kokkos.HostSpace()
 # Kokkos has a tendency to make things harder because of hyperthreads, therefore '≥' and not '=='
 @test Kokkos.concurrency(Kokkos.OpenMP()) ≥ Threads.nthreads() skip=!TEST_OPENMP
 
+host_exec = Kokkos.DEFAULT_HOST_SPACE()
+skip_partition = Kokkos.KOKKOS_VERSION < v"4.0.0"
+if !skip_partition
+    partitions = Kokkos.partition_space(host_exec, [1, 2])
+    @test length(partitions) == 2
+    @test all(p -> Kokkos.main_space_type(p) === Kokkos.DEFAULT_HOST_SPACE, partitions)
+    @test length(Kokkos.partition_space(host_exec, 3)) == 3
+    @test all(==(nothing), fetch.([Threads.@spawn Kokkos.fence(p) for p in partitions]))
+else
+    @test_throws r"Kokkos 4.0" Kokkos.partition_space(host_exec, [1, 2])
+end
+@test_throws r"positive" Kokkos.partition_space(host_exec, [1, 0])
+@test_throws r"at least one" Kokkos.partition_space(host_exec, Int[])
+
 alloc_ptr = Kokkos.allocate(host_space, 10)
 @test alloc_ptr !== C_NULL
 Kokkos.deallocate(host_space, alloc_ptr, 10)
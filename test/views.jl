@@ -92,6 +92,25 @@ v3 .= LinearIndices(a3)'
 @test_throws BoundsError v3[(n3 .+ (1, 0))...]
 @test_throws BoundsError v3[(n3 .+ (0, 1))...]
 
+@testset "Cached metadata" begin
+    for v in (v1, v2, v3)
+        meta = Kokkos.Views._metadata(v)
+        @test meta.host_accessible
+        @test meta.data == pointer(v) == Ptr{eltype(v)}(Kokkos.view_data(v).cpp_object)
+        @test meta.dims == Kokkos.Views._get_dims(v)
+        @test meta.strides == Kokkos.Views._get_strides(v)
+    end
+
+    v3_copy = similar(v3)
+    @test Kokkos.Views._metadata(v3_copy).data != Kokkos.Views._metadata(v3).data
+    @test Kokkos.Views._metadata(v3_copy).dims == Kokkos.Views._metadata(v3).dims
+
+    # The `Kokkos::View` is at the start of the C++ object, for `Ref{View}` arguments of `ccall`s
+    @test Kokkos.Views._get_metadata_offset(Kokkos.main_view_type(v1)) == Kokkos.Views.VIEW_METADATA_OFFSET
+    Kokkos.update_metadata!(v1)
+    @test Kokkos.Views._metadata(v1).dims == Kokkos.Views._get_dims(v1)
+end
+
 @testset "LayoutLeft" begin
     v3_l = View{Int64, 2, Kokkos.LayoutLeft}(n3)
 
@@ -268,6 +287,53 @@ view_t = Kokkos.View{Float64, 2, Kokkos.LayoutRight, Kokkos.HostSpace}
 @test occursin("MemoryTraits", String(Kokkos.cxx_type_name(view_t, true)))  # This should be broad enough to pass on all compilers
 
 
+@testset "Array aliasing" begin
+    a = collect(reshape(1.0:12.0, 3, 4))
+    v = View(a)
+    @test Kokkos.main_view_type(v) === View{Float64, 2, Kokkos.LayoutLeft, Kokkos.HostSpace, Kokkos.MemoryTraits{0}}
+    @test pointer(v) == pointer(a)
+    @test v == a
+    v[2, 3] = -1.0
+    @test a[2, 3] == -1.0
+
+    # The view keeps the array alive
+    v = View(collect(1:10))
+    GC.gc(true)
+    @test v == 1:10
+
+    v = View{Float64}(undef, 3, 4; mem_space=Kokkos.HostSpace, layout=Kokkos.LayoutLeft)
+    v .= a
+    a_v = unsafe_wrap(Array, v)
+    @test a_v isa Matrix{Float64}
+    @test pointer(a_v) == pointer(v)
+    @test a_v == a
+    a_v[1, 1] = 42.0
+    @test v[1, 1] == 42.0
+    @test Array(v) !== a_v && pointer(Array(v)) != pointer(v)  # `Array(v)` is still a copy
+
+    # The array keeps the view alive
+    a_v = unsafe_wrap(Array{Float64, 1}, Kokkos.View{Float64}(undef, 10; mem_space=Kokkos.HostSpace) .= 2.0)
+    GC.gc(true)
+    @test all(==(2.0), a_v)
+
+    # The array holds its own reference to the allocation: finalizing the view does not free it
+    v_f = Kokkos.View{Float64}(undef, 10; mem_space=Kokkos.HostSpace) .= 3.0
+    a_v = unsafe_wrap(Array, v_f)
+    @test !Kokkos.Views._has_julia_owner(v_f)
+    finalize(v_f)
+    @test all(==(3.0), a_v)
+
+    # Only subviews of views of Julia-owned data root their parent
+    @test Kokkos.Views._has_julia_owner(View(a))
+    @test Kokkos.Views._has_julia_owner(Kokkos.subview(View(a), (:, 1)))
+    @test !Kokkos.Views._has_julia_owner(Kokkos.subview(v, (:, 1)))
+
+    v_right = View{Float64}(undef, 3, 4; mem_space=Kokkos.HostSpace, layout=Kokkos.LayoutRight)
+    @test_throws "column-major strides" unsafe_wrap(Array, v_right)
+    @test_throws "column-major strides" unsafe_wrap(Array, Kokkos.subview(v, (1:2:3, :)))
+end
+
+
 @testset "Printing" begin
     buf = IOBuffer()
     show(buf, MIME"text/plain"(), v3)  # print as `display` would
@@ -311,8 +377,10 @@ end
             if isnothing(exec_space)
                 Kokkos.deep_copy(v_dst, v_src)
             else
-                Kokkos.deep_copy(exec_space, v_dst, v_src)
-                Kokkos.fence(exec_space)
+                handle = Kokkos.deep_copy(exec_space, v_dst, v_src)
+                @test handle isa Kokkos.DeepCopyHandle
+                wait(handle)
+                @test Kokkos.isdone(handle)
             end
 
             @test v_dst == v_src
@@ -324,6 +392,41 @@ end
     dc_v3 = Kokkos.View{Int64}(undef, 1, 1)
     @test_throws r"Views with the same type" Kokkos.deep_copy(dc_v1, dc_v2)
     @test_throws r"Views with the same number of dimensions" Kokkos.deep_copy(dc_v1, dc_v3)
+
+    @testset "Completion handle" begin
+        exec_space = Kokkos.DEFAULT_HOST_SPACE()
+        v_src = Kokkos.View{Float64}(undef, 100)
+        v_dst = Kokkos.View{Float64}(100)
+        v_src .= 1:100
+
+        handle = Kokkos.deep_copy(exec_space, v_dst, v_src)
+        Kokkos.fence(handle)
+        @test Kokkos.isdone(handle)
+        @test v_dst == v_src
+        @test occursin("done", repr(handle))
+
+        # Host backends complete the copy before `deep_copy` returns: no fencing task is needed
+        v_dst .= 0
+        handle = Kokkos.deep_copy(exec_space, v_dst, v_src)
+        @test Kokkos.isdone(handle)
+        @test isnothing(@atomic handle.task)
+        @test v_dst == v_src
+
+        v_dst .= 0
+        handles = [Kokkos.deep_copy(exec_space, v, v_src) for v in (v_dst, similar(v_dst))]
+        foreach(wait, handles)
+        @test all(Kokkos.isdone, handles)
+        @test v_dst == v_src
+
+        if Kokkos.KOKKOS_VERSION ≥ v"4.0.0"  # Needed by `partition_space`
+            v_dst .= 0
+            v_dst2 = similar(v_dst)
+            part_1, part_2 = Kokkos.partition_space(exec_space, 2)
+            tasks = [Threads.@spawn wait(Kokkos.deep_copy(p, v, v_src)) for (p, v) in ((part_1, v_dst), (part_2, v_dst2))]
+            foreach(wait, tasks)
+            @test v_dst == v_dst2 == v_src
+        end
+    end
 end
 
 
@@ -383,12 +486,12 @@ end
 
     sv2 = Kokkos.subview(v, (:, 1))
     @test typeof(sv2) === Kokkos.impl_view_type(View{Float64, 1, Kokkos.LayoutStride, Kokkos.HostSpace})
-    @test Kokkos.main_view_type(sv2) === View{Float64, 1, Kokkos.LayoutStride, Kokkos.HostSpace}
+    @test Kokkos.main_view_type(sv2) === View{Float64, 1, Kokkos.LayoutStride, Kokkos.HostSpace, Kokkos.MemoryTraits{0}}
     @test sv2 == [1.0, 2.0, 3.0, 4.0]
 
     sv3 = Kokkos.subview(v, (1,))
     @test typeof(sv3) === Kokkos.impl_view_type(View{Float64, 1, array_layout(v), memory_space(v)})
-    @test Kokkos.main_view_type(sv3) === View{Float64, 1, array_layout(v), memory_space(v)}
+    @test Kokkos.main_view_type(sv3) === View{Float64, 1, array_layout(v), memory_space(v), Kokkos.MemoryTraits{0}}
     @test sv3 == [1.0, 5.0, 9.0, 13.0]
 
     sv4 = Kokkos.subview(v, (1, :))
@@ -402,4 +505,515 @@ end
     @test sv5 == [1.0 13.0 ; 4.0 16.0]
 end
 
+
+@testset "Strided subview" begin
+    v = Kokkos.View{Float64}(undef, 4, 4)
+    v[:] .= collect(1:length(v))
+    a = Array(v)
+
+    sv1 = Kokkos.subview(v, (1:3:4, 1:3:4))  # The "corners" of the matrix
+    @test Kokkos.main_view_type(sv1) === View{Float64, 2, Kokkos.LayoutStride, Kokkos.HostSpace, Kokkos.MemoryTraits{0}}
+    @test pointer(sv1) == pointer(v)
+    @test sv1 == a[1:3:4, 1:3:4]
+    @test strides(sv1) == 3 .* strides(v)
+
+    sv2 = Kokkos.subview(v, (2:2:4,))  # Completed with `:`
+    @test size(sv2) == (2, 4)
+    @test sv2 == a[2:2:4, :]
+
+    sv3 = Kokkos.subview(v, 2:2:4, 3)
+    @test Kokkos.main_view_type(sv3) === View{Float64, 1, Kokkos.LayoutStride, Kokkos.HostSpace, Kokkos.MemoryTraits{0}}
+    @test sv3 == a[2:2:4, 3]
+
+    # No copy: writes are visible in the parent view
+    sv3 .= -1.0
+    @test v[2, 3] == v[4, 3] == -1.0
+    @test v[3, 3] == a[3, 3]
+
+    # Subviews of strided subviews
+    sv4 = Kokkos.subview(sv1, (1:1:2, 2))
+    @test sv4 == [13.0, 16.0]
+
+    @test size(Kokkos.subview(v, (3:2:2, :))) == (0, 4)
+    @test_throws BoundsError Kokkos.subview(v, (1:2:5, :))
+    @test_throws BoundsError Kokkos.subview(v, (0:2:2, :))
+    @test_throws ArgumentError Kokkos.subview(v, (4:-1:1, :))
+end
+
+
+@testset "Subview from bounds" begin
+    @testset "$layout" for layout in (Kokkos.LayoutLeft, Kokkos.LayoutRight)
+        a = reshape(collect(1.0:60.0), 3, 4, 5)
+        v = View{Float64, 3, layout}(size(a))
+        copyto!(v, a)
+
+        for indexes in ((2, :, :), (:, :, 2), (:, 2, :), (2:3, 1, 2:4), (1, 2, :), (:, 3, 4), (2, 3, 4), (:, 2:3))
+            sv = Kokkos.subview(v, indexes)
+            sub_dim, sub_layout = Kokkos.Views._get_subview_dim_and_layout(3, layout, typeof(indexes))
+            @test Kokkos.main_view_type(sv) === View{Float64, sub_dim, sub_layout, memory_space(v), Kokkos.MemoryTraits{0}}
+            full_indexes = (indexes..., ntuple(Returns(:), 3 - length(indexes))...)
+            @test sv == view(a, full_indexes...)
+            offset = sum((first.(to_indices(v, full_indexes)) .- 1) .* strides(v))
+            @test pointer(sv) == pointer(v) + offset * sizeof(Float64)
+        end
+
+        @test Kokkos.Views._subview_bounds(v, (2, :, 3:4)) == [1, 0, 1,  0, 1, 4,  2, 1, 2]
+        @test_throws BoundsError Kokkos.subview(v, (4, :, :))
+        @test_throws BoundsError Kokkos.subview(v, (:, 0:2, :))
+        @test_throws BoundsError Kokkos.subview(v, (1, 1, 1, 1))
+    end
+end
+
+
+@testset "Region access" begin
+    @testset "$layout" for layout in (Kokkos.LayoutLeft, Kokkos.LayoutRight)
+        a = reshape(collect(1.0:12.0), 3, 4)
+        v = View{Float64, 2, layout}(size(a))
+        v .= a
+
+        @test v[:, 2] isa Vector{Float64}
+        @test v[:, 2] == a[:, 2]
+        @test v[2, :] == a[2, :]
+        @test v[2:3, 2:4] isa Matrix{Float64}
+        @test v[2:3, 2:4] == a[2:3, 2:4]
+        @test v[:, :] == a
+        @test v[3:2, :] == a[3:2, :]
+        @test_throws BoundsError v[1:4, 1]
+        @test v[Int32(2), UInt(3)] === a[2, 3]  # Non-`Int` scalar indexing is not a region
+        v[Int32(2), UInt(3)] = 0.5
+        @test v[2, 3] == 0.5
+        v[2, 3] = a[2, 3]
+
+        v[:, 1] = [-1.0, -2.0, -3.0]
+        @test v[:, 1] == [-1.0, -2.0, -3.0]
+        v[1:2, 3:4] = [10 20 ; 30 40]  # Converted to the view's eltype
+        @test v[1:2, 3:4] == [10.0 20.0 ; 30.0 40.0]
+        @test_throws DimensionMismatch v[:, 1] = [1.0, 2.0]
+
+        b = zeros(Float64, size(v))
+        copyto!(b, v)
+        @test b == v
+        copyto!(v, a)
+        @test v == a
+    end
+
+    @testset "LayoutStride" begin
+        a = reshape(collect(1:16), 4, 4)
+        v = View{Int64, 2, Kokkos.LayoutStride}(size(a); layout=Kokkos.LayoutStride((2, 8)))
+        v .= a
+        @test v[2:3, :] == a[2:3, :]
+        v[:, 4] = [0, 0, 0, 0]
+        @test v[:, 4] == zeros(Int64, 4)
+    end
+end
+
+
+@testset "Memory traits" begin
+    v = View{Float64}(undef, 4)
+    @test Kokkos.memory_traits(v) === Kokkos.MemoryTraits{0}
+    @test Kokkos.memory_traits(View{Float64, 1, Kokkos.LayoutRight, Kokkos.HostSpace}) === Kokkos.MemoryTraits{0}
+    @test Kokkos.has_memory_trait(Kokkos.MemoryTraits{Kokkos.Unmanaged | Kokkos.Atomic}, Kokkos.Atomic)
+    @test !Kokkos.has_memory_trait(Kokkos.MemoryTraits{Kokkos.Unmanaged}, Kokkos.Atomic)
+
+    unmanaged_t = View{Float64, 1, Kokkos.LayoutLeft, Kokkos.HostSpace, Kokkos.MemoryTraits{Kokkos.Unmanaged}}
+    a = collect(1.0:8.0)
+    v_um = view_wrap(unmanaged_t, a)
+    @test Kokkos.main_view_type(v_um) === unmanaged_t
+    @test Kokkos.get_tracker(v_um) == C_NULL
+    @test v_um == a
+    @test occursin("MemoryTraits<1>", String(Kokkos.cxx_type_name(v_um)))
+    @test_throws ErrorException unmanaged_t(undef, 8)
+
+    v_sub = Kokkos.subview(v_um, (2:4,))
+    @test Kokkos.memory_traits(v_sub) === Kokkos.MemoryTraits{Kokkos.Unmanaged}
+    @test v_sub == a[2:4]
+
+    atomic_t = View{Int64, 1, Kokkos.LayoutRight, Kokkos.HostSpace, Kokkos.MemoryTraits{Kokkos.Atomic}}
+    v_at = atomic_t(undef, 5)
+    v_at .= 1:5
+    v_at[3] += 10
+    @test v_at == [1, 2, 13, 4, 5]
+    @test v_at[3] isa Int64  # Atomic load
+    @test Kokkos.Views._atomic_access(atomic_t)
+    @test !Kokkos.Views._atomic_access(View{Int64, 1, Kokkos.LayoutRight, Kokkos.HostSpace})
+end
+
+
+@testset "Reductions" begin
+    a = reshape(collect(1.0:12.0), 3, 4)
+    @testset "$layout" for layout in (Kokkos.LayoutLeft, Kokkos.LayoutRight)
+        v = View{Float64, 2, layout, Kokkos.HostSpace}(size(a))
+        copyto!(v, a)
+
+        @test sum(v) == sum(a)
+        @test prod(v) == prod(a)
+        @test minimum(v) == 1.0
+        @test maximum(v) == 12.0
+        @test extrema(v) == (1.0, 12.0)
+        @test dot(v, v) == dot(a, a)
+        @test norm(v) ≈ norm(a)
+        @test norm(v, 1) == norm(a, 1)
+        @test norm(v, Inf) == norm(a, Inf)
+
+        for dims in (1, 2)
+            s = sum(v; dims)
+            @test s isa View{Float64, 2, layout}
+            @test s == sum(a; dims)
+            @test maximum(v; dims) == maximum(a; dims)
+        end
+    end
+
+    v_s = View{Int64, 2, Kokkos.LayoutStride, Kokkos.HostSpace}((3, 4); layout=Kokkos.LayoutStride((2, 8)))
+    a_i = reshape(collect(Int64, -5:6), 3, 4)
+    copyto!(v_s, a_i)
+    @test sum(v_s) == sum(a_i)
+    @test minimum(v_s; dims=2) == minimum(a_i; dims=2)
+    @test sum(v_s; dims=1) isa View{Int64, 2, Kokkos.LayoutLeft}
+
+    # No overflow or underflow of the sum of squares
+    for a_n in ([1e200, 1e200], [1e-200, 1e-200], [0.0, 0.0], [Inf, 1.0])
+        v_n = View{Float64}(undef, 2; mem_space=Kokkos.HostSpace)
+        copyto!(v_n, a_n)
+        @test norm(v_n) ≈ norm(a_n)
+    end
+
+    # NaNs are propagated and `-0.0 < 0.0`, like Julia's `min` and `max`
+    for a_n in ([1.0, NaN, 3.0], [NaN, 1.0, 2.0], [0.0, -0.0, 0.0], [-0.0, 0.0, -0.0], [Inf, -Inf, 1.0])
+        v_n = View{Float64}(undef, 3; mem_space=Kokkos.HostSpace)
+        copyto!(v_n, a_n)
+        @test isequal(minimum(v_n), minimum(a_n))
+        @test isequal(maximum(v_n), maximum(a_n))
+        @test isequal(extrema(v_n), extrema(a_n))
+        @test isequal(norm(v_n, Inf), norm(a_n, Inf))
+        @test isequal(minimum(v_n; dims=1), minimum(a_n; dims=1))
+    end
+
+    # The generic norm also works for views in the default memory space
+    v_p = View{Float64}(undef, 4)
+    copyto!(v_p, [1.0, -2.0, 3.0, -4.0])
+    @test norm(v_p, 3) ≈ norm([1.0, -2.0, 3.0, -4.0], 3)
+
+    @test sum(View{Float64}(undef, 0)) == 0.0
+    @test_throws Exception minimum(View{Float64}(undef, 0))
+
+    v_i32 = View{Int32}(undef, 4)
+    v_i32 .= 1
+    @test sum(v_i32) === Int64(4)  # Promoted by Julia: generic method
+end
+
+
+@testset "Algorithms" begin
+    v = View{Float64}(undef, 10)
+    fill!(v, 2)
+    @test all(==(2.0), v)
+
+    v2 = View{Int64, 2, Kokkos.LayoutRight, Kokkos.HostSpace}(undef, 3, 3)
+    fill!(v2, 7)
+    @test v2 == fill(7, 3, 3)
+
+    a = [3, -1, 4, -1, 5, -9, 2, 6]
+    src = View{Int64}(undef, length(a)); copyto!(src, a)
+    dest = View{Int64}(length(a))
+    n = Kokkos.copy_if!(>(0), dest, src)
+    @test n == 5
+    @test dest[1:n] == filter(>(0), a)
+    @test Kokkos.copy_if!(iseven, dest, src) == count(iseven, a)  # Generic fallback
+
+    @test findfirst(==(-1), src) == 2
+    @test findfirst(<(-5), src) == 6
+    @test findfirst(>(100), src) === nothing
+    @test findfirst(==(1.5), src) === nothing  # Not representable as an Int64: generic fallback
+
+    map!(*(2), dest, src)
+    @test dest == a .* 2
+    map!(+(1), dest, dest)
+    @test dest == a .* 2 .+ 1
+
+    reverse!(src)
+    @test src == reverse(a)
+
+    s = View{Int64}(undef, 7); copyto!(s, [1, 1, 2, 3, 3, 3, 8])
+    u = unique!(s)
+    @test u == [1, 2, 3, 8]
+    @test unique(View{Int64}(undef, 0)) |> isempty
+
+    # Always a `Vector`, with `isequal` semantics
+    for a_u in ([1.0, 1.0, 2.0], [2.0, 1.0, 2.0], [-0.0, 0.0, 0.0, 1.0, NaN, NaN])
+        v_u = View{Float64}(undef, length(a_u)); copyto!(v_u, a_u)
+        u = unique(v_u)
+        @test u isa Vector{Float64}
+        @test isequal(u, unique(a_u))
+    end
+end
+
+
+@testset "Sort" begin
+    a = [5.0, -2.0, 3.5, 0.0, 3.5, 10.0, -7.25]
+    v = View{Float64}(undef, length(a)); copyto!(v, a)
+    @test sort!(v) === v
+    @test v == sort(a)
+    sort!(v; rev=true)
+    @test v == sort(a; rev=true)
+
+    k = View{Int64}(undef, 8); copyto!(k, [4, 1, 3, 1, 8, 2, 7, 5])
+    vals = View{Float64}(undef, 8); copyto!(vals, collect(1.0:8.0))
+    a_k = Array(k)
+
+    perm = Kokkos.bin_sort(k)
+    @test perm isa View{Int64, 1, Kokkos.LayoutLeft}
+    @test k == a_k  # Not modified
+    @test a_k[Array(perm)] == sort(a_k)
+
+    Kokkos.sort_by_key!(k, vals)
+    @test k == sort(a_k)
+    @test a_k[Int.(Array(vals))] == Array(k)
+
+    same_k = View{Int64}(undef, 4); fill!(same_k, 3)
+    @test Kokkos.bin_sort!(same_k) == [1, 2, 3, 4]
+
+    w = View{Float64}(undef, 3); copyto!(w, [10.0, 20.0, 30.0])
+    p = View{Int64, 1, Kokkos.LayoutLeft, memory_space(w)}(undef, 3); copyto!(p, [3, 1, 2])
+    permute!(w, p)
+    @test w == [30.0, 10.0, 20.0]
+
+    copyto!(p, [3, 0, 2])
+    @test_throws ErrorException permute!(w, p)
+    @test w == [30.0, 10.0, 20.0]  # Not modified
+    copyto!(p, [1, 4, 2])
+    @test_throws ErrorException permute!(w, p)
+
+    nan_k = View{Float64}(undef, 3); copyto!(nan_k, [1.0, NaN, 2.0])
+    @test_throws ErrorException Kokkos.bin_sort(nan_k)
+end
+
+
+@testset "Batch compilation" begin
+    libs_dir = Kokkos.Wrapper.get_kokkos_func_libs_dir()
+    batch_mem_space = Kokkos.DEFAULT_HOST_MEM_SPACE
+    manifest = [
+        "views" => (; view_type=Int16, view_dim=dim, view_layout=Kokkos.LayoutRight, mem_space=batch_mem_space)
+        for dim in 1:3
+    ]
+
+    libs_count = length(readdir(libs_dir))
+    @test Kokkos.DynamicCompilation.compile_batch(manifest) === nothing
+    @test length(readdir(libs_dir)) == libs_count + 3
+    # Only the persistent build directories are kept
+    instances_dir = joinpath(Kokkos.Wrapper.build_dir(Kokkos.Wrapper.KOKKOS_LIB_PROJECT), "instances")
+    @test readdir(instances_dir) ⊆ ["build_$i" for i in 1:Kokkos.DynamicCompilation.INSTANCES_BUILD_DIRS]
+
+    # Already compiled libs are skipped
+    @test Kokkos.DynamicCompilation.compile_batch(manifest) === nothing
+    @test length(readdir(libs_dir)) == libs_count + 3
+
+    # Only loaded from now on
+    v = View{Int16}(undef, 3, 4; layout=Kokkos.LayoutRight, mem_space=batch_mem_space)
+    v .= 7
+    @test all(==(7), v)
+    @test length(readdir(libs_dir)) == libs_count + 3
+end
+
+
+@testset "Concurrent compilation" begin
+    # Different libraries are compiled independently, in their own build directory
+    tasks = [Threads.@spawn View{UInt16}(undef, ntuple(Returns(2), dim)) for dim in 1:2]
+    @test size.(fetch.(tasks)) == [(2,), (2, 2)]
+    instances_dir = joinpath(Kokkos.Wrapper.build_dir(Kokkos.Wrapper.KOKKOS_LIB_PROJECT), "instances")
+    @test readdir(instances_dir) ⊆ ["build_$i" for i in 1:Kokkos.DynamicCompilation.INSTANCES_BUILD_DIRS]
+end
+
+
+@testset "Prebuilt views" begin
+    prebuilt_mem_space = Kokkos.DEFAULT_HOST_MEM_SPACE
+    view_types = [View{UInt8, D, L, prebuilt_mem_space} for D in 1:2, L in (Kokkos.LayoutLeft, Kokkos.LayoutRight)]
+
+    manifest = Kokkos.Views._prebuilt_views_manifest(Kokkos.main_view_type.(vec(view_types)))
+    @test count(p -> first(p) == "views", manifest) == 4
+    @test count(p -> first(p) == "subviews", manifest) == 1 + 2 + 1 + 2
+    @test count(p -> first(p) == "copy", manifest) == 2 * 2 + 2 * 2  # 2 layouts to 2 layouts for each dim
+
+    @test Kokkos.prebuild_views(view_types) == unique(Kokkos.main_view_type.(vec(view_types)))
+    @test all(t -> t in Kokkos.Views._COMPILED_VIEW_TYPES, Kokkos.main_view_type.(view_types))
+
+    # Everything is already compiled
+    libs_count = length(readdir(Kokkos.Wrapper.get_kokkos_func_libs_dir()))
+    v = View{UInt8}(undef, 3, 4; layout=Kokkos.LayoutLeft, mem_space=prebuilt_mem_space)
+    copyto!(v, fill(0x2, 3, 4))
+    v2 = View{UInt8}(undef, 3, 4; layout=Kokkos.LayoutRight, mem_space=prebuilt_mem_space)
+    copyto!(v2, v)
+    @test all(==(0x2), v2)
+    @test all(==(0x2), Kokkos.subview(v2, (1, :)))
+    @test length(readdir(Kokkos.Wrapper.get_kokkos_func_libs_dir())) == libs_count
+
+    config = Dict{String, Any}("types" => ["Float32"], "dims" => [1, 2], "layouts" => ["LayoutRight"])
+    @test Kokkos.Views._prebuilt_view_types(config) ==
+        [View{Float32, D, Kokkos.LayoutRight, S} for D in 1:2, S in filter(Kokkos.accessible, collect(Kokkos.ENABLED_MEM_SPACES))] |> vec
+    config["types"] = ["String"]
+    @test_throws "bits type" Kokkos.Views._prebuilt_view_types(config)
+end
+
+
+@testset "View pool" begin
+    pool_mem_space = Kokkos.DEFAULT_HOST_MEM_SPACE
+    @test !Kokkos.view_pool_stats(pool_mem_space).enabled
+
+    Kokkos.enable_view_pool(pool_mem_space)
+    @test Kokkos.view_pool_stats(pool_mem_space).enabled
+
+    v1 = View{Float64}(undef, 10, 10; mem_space=pool_mem_space)
+    stats = Kokkos.view_pool_stats(pool_mem_space)
+    @test stats.misses == 1 && stats.hits == 0
+    @test stats.in_use_bytes == nextpow(2, sizeof(Float64) * 100)
+    v1 .= 1.5
+    Base.finalize(v1)
+    @test Kokkos.view_pool_stats(pool_mem_space).in_use_bytes == 0
+    @test Kokkos.view_pool_stats(pool_mem_space).cached_bytes == nextpow(2, sizeof(Float64) * 100)
+
+    # Same size class: the block is reused
+    v2 = View{Float64}(10, 9; mem_space=pool_mem_space)
+    stats = Kokkos.view_pool_stats(pool_mem_space)
+    @test stats.misses == 1 && stats.hits == 1
+    @test stats.cached_bytes == 0
+    @test all(iszero, v2)  # `zero_fill` still applies to reused blocks
+
+    # Views with a memory space instance are never pooled
+    v3 = View{Float64}(undef, 10, 10; mem_space=pool_mem_space(), track=false)
+    @test Kokkos.view_pool_stats(pool_mem_space).misses == 1
+
+    # The block of a pooled view is labeled with the view's label
+    Kokkos.enable_memory_telemetry()
+    v4 = View{Float64}(undef, 10, 10; mem_space=pool_mem_space, label="pooled_v4")
+    telemetry = only(filter(s -> s.space === Kokkos.main_space_type(pool_mem_space), Kokkos.memory_telemetry().spaces))
+    @test only(filter(l -> l.label == "pooled_v4", telemetry.labels)).live_allocations == 1
+    @test !any(l -> l.label == "[unlabeled]", telemetry.labels)  # New blocks are allocated with the pool's label
+    Base.finalize(v4)
+    telemetry = only(filter(s -> s.space === Kokkos.main_space_type(pool_mem_space), Kokkos.memory_telemetry().spaces))
+    @test !any(l -> l.label == "pooled_v4", telemetry.labels)
+    @test only(filter(l -> l.label == Kokkos.Views._POOL_LABEL, telemetry.labels)).live_allocations == 1
+    Kokkos.disable_memory_telemetry()
+
+    # Subviews keep their pooled parent alive
+    v5 = View{Float64}(undef, 10, 10; mem_space=pool_mem_space)
+    v5_sub = Kokkos.subview(v5, 1:5, :)
+    v5_ref = WeakRef(v5)
+    v5 = nothing
+    GC.gc(true)
+    @test !isnothing(v5_ref.value)
+    Base.finalize(v5_sub)
+    Base.finalize(v5_ref.value)
+
+    Kokkos.disable_view_pool(pool_mem_space)
+    @test !Kokkos.view_pool_stats(pool_mem_space).enabled
+    Base.finalize(v2)
+    stats = Kokkos.view_pool_stats(pool_mem_space)
+    @test stats.in_use_bytes == 0 && stats.cached_bytes == 0
+    Base.finalize(v3)
+end
+
+
+@testset "Tracked views" begin
+    tracked = Kokkos.Views.TRACKED_VIEWS
+    v = View{Float64}(undef, 10, 10)
+    v_untracked = View{Float64}(undef, 10, 10; track=false)
+    @test haskey(tracked, v)
+    @test !haskey(tracked, v_untracked)
+    @test haskey(tracked, Kokkos.subview(v, (:, 1)))
+    @test !haskey(tracked, Kokkos.subview(v_untracked, (:, 1)))
+
+    # Concurrent allocations, spread over all shards
+    task_views = fetch.([Threads.@spawn [View{Float64}(undef, 4) for _ in 1:100] for _ in 1:4])
+    @test all(tv -> haskey(tracked, tv), Iterators.flatten(task_views))
+    @test count(_ -> true, tracked) >= 401
+    @test !islocked(tracked)
+
+    task_views = nothing
+    GC.gc(true)
+    @test haskey(tracked, v)
+    Base.finalize(v_untracked)
+end
+
+
+@testset "Fused broadcast" begin
+    n = (7, 5)
+    a_a, a_b, a_c = rand(n...), rand(n...), rand(n...)
+    a = View{Float64}(undef, n); copyto!(a, a_a)
+    b = View{Float64}(undef, n); copyto!(b, a_b)
+    c = View{Float64}(undef, n); copyto!(c, a_c)
+    dest = View{Float64}(undef, n)
+
+    bc = Broadcast.instantiate(Broadcast.broadcasted(+, a, Broadcast.broadcasted(*, b, 2)))
+    expr, views, scalars = Kokkos.Views._broadcast_expr(dest, bc)
+    @test expr == "(BC_VIEW(0) + (BC_VIEW(1) * BC_SCALAR(0)))"
+    @test all(views .=== (a, b))
+    @test scalars == [2.0]
+
+    bc = Broadcast.instantiate(Broadcast.broadcasted(*, a, Broadcast.broadcasted(sqrt, a)))
+    @test first(Kokkos.Views._broadcast_expr(dest, bc)) == "(BC_VIEW(0) * broadcast_math::sqrt(BC_VIEW(0)))"
+
+    bc = Broadcast.instantiate(Broadcast.broadcasted(round, a))
+    @test isnothing(first(Kokkos.Views._broadcast_expr(dest, bc)))  # Unsupported function
+    bc = Broadcast.instantiate(Broadcast.broadcasted(+, a, Kokkos.subview(a, (:, 1))))
+    @test isnothing(first(Kokkos.Views._broadcast_expr(dest, bc)))  # Different view types and sizes
+
+    kernels_count = length(Kokkos.Views._BROADCAST_KERNELS)
+    dest .= a .* b .+ 2.0 .* sqrt.(c)
+    @test Array(dest) ≈ a_a .* a_b .+ 2.0 .* sqrt.(a_c)
+    @test length(Kokkos.Views._BROADCAST_KERNELS) == kernels_count + 1
+
+    # Only the values of the scalars changed: same kernel
+    dest .= a .* b .+ 3 .* sqrt.(c)
+    @test Array(dest) ≈ a_a .* a_b .+ 3 .* sqrt.(a_c)
+    @test length(Kokkos.Views._BROADCAST_KERNELS) == kernels_count + 1
+
+    # `dest` can be an operand
+    dest .= max.(dest, a) .- b ./ 2
+    @test Array(dest) ≈ max.(a_a .* a_b .+ 3 .* sqrt.(a_c), a_a) .- a_b ./ 2
+
+    # NaNs propagate through `min` and `max`
+    copyto!(c, fill(NaN, n))
+    dest .= min.(a, c) .+ max.(c, b)
+    @test all(isnan, Array(dest))
+
+    # Generic fallbacks
+    dest .= round.(a)
+    @test Array(dest) == round.(a_a)
+    dest .= a_b
+    @test Array(dest) == a_b
+    v_i = View{Int64}(undef, n); v_i .= 2
+    v_i .= v_i .* 3
+    @test all(==(6), v_i)
+end
+
+
+@testset "Inline kernels" begin
+    x = View{Float64}(undef, 10; mem_space=Kokkos.DEFAULT_HOST_MEM_SPACE); copyto!(x, collect(1.0:10.0))
+    y = View{Float64}(undef, 10; mem_space=Kokkos.DEFAULT_HOST_MEM_SPACE); copyto!(y, ones(10))
+    V = Kokkos.main_view_type(x)
+
+    axpy = Kokkos.@kokkos_kernel axpy(y::V, x::V, alpha::Float64) """
+        y(i) += alpha * x(i);
+    """
+    @test axpy isa Kokkos.KokkosKernel
+    @test axpy(length(y), y, x, 2) === nothing  # `2` is converted to `Float64`
+    @test Array(y) == 1 .+ 2 .* (1.0:10.0)
+
+    dot = Kokkos.compile_kernel("dot", "result += x(i) * y(i);", [:x => V, :y => V]; reduce=Float64)
+    @test dot(length(x), x, y) == sum((1.0:10.0) .* (1 .+ 2 .* (1.0:10.0)))
+    x_max = Kokkos.compile_kernel("x_max", "if (x(i) > result) result = x(i);", [:x => V]; reduce=Float64, reducer=:max)
+    @test x_max(length(x), x) == 10.0
+
+    # Same kernel: loaded from the cache
+    libs_count = length(readdir(Kokkos.Wrapper.get_kokkos_func_libs_dir()))
+    dot2 = Kokkos.compile_kernel("dot", "result += x(i) * y(i);", [:x => V, :y => V]; reduce=Float64)
+    @test dot2(5, x, y) == sum((1.0:5.0) .* (1 .+ 2 .* (1.0:5.0)))
+    @test length(readdir(Kokkos.Wrapper.get_kokkos_func_libs_dir())) == libs_count
+    @test dot2.func === dot.func  # Not loaded again
+
+    @test_throws "expects 3 arguments" axpy(length(y), y, x)
+    @test_throws "to be a" axpy(length(y), y, View{Float32}(undef, 10), 1.0)
+    @test_throws "complete view type" Kokkos.compile_kernel("k", "", [:x => View{Float64, 1}])
+    @test_throws "views or scalars" Kokkos.compile_kernel("k", "", [:x => Vector{Float64}])
+    @test_throws "kernel names" Kokkos.compile_kernel("k-1", "", [:x => V])
+end
+
 end
@@ -250,7 +250,10 @@ end
                 end
             else
                 if can_deep_copy
-                    @test Kokkos.deep_copy(exec_space, v_dst, v_src) === nothing
+                    handle = Kokkos.deep_copy(exec_space, v_dst, v_src)
+                    @test handle isa Kokkos.DeepCopyHandle
+                    wait(handle)
+                    @test Kokkos.isdone(handle)
                 else
                     @test_throws DEEP_COPY_ERRORS_REGEX Kokkos.deep_copy(exec_space, v_dst, v_src)
                 end
@@ -308,11 +311,11 @@ end
 
     sv2 = Kokkos.subview(v, (:, 1))
     @test typeof(sv2) === Kokkos.impl_view_type(View{Float64, 1, array_layout(v), TEST_MAIN_MEM_SPACE_DEVICE})
-    @test Kokkos.main_view_type(sv2) === View{Float64, 1, array_layout(v), TEST_MAIN_MEM_SPACE_DEVICE}
+    @test Kokkos.main_view_type(sv2) === View{Float64, 1, array_layout(v), TEST_MAIN_MEM_SPACE_DEVICE, Kokkos.MemoryTraits{0}}
 
     sv3 = Kokkos.subview(v, (1,))
     @test typeof(sv3) === Kokkos.impl_view_type(View{Float64, 1, Kokkos.LayoutStride, memory_space(v)})
-    @test Kokkos.main_view_type(sv3) === View{Float64, 1, Kokkos.LayoutStride, memory_space(v)}
+    @test Kokkos.main_view_type(sv3) === View{Float64, 1, Kokkos.LayoutStride, memory_space(v), Kokkos.MemoryTraits{0}}
 
     sv4 = Kokkos.subview(v, (1, :))
     @test typeof(sv4) === typeof(sv3)